@@ -0,0 +1,158 @@
+#pragma region AllocationCounter.cpp
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <malloc.h>
+#include "AllocationCounter.hpp"
+
+namespace
+{
+    std::atomic<uint64_t> gAllocations = 0;
+    std::atomic<uint64_t> gBytes = 0;
+    std::atomic<int64_t> gLiveBytes = 0;
+
+    auto UsableSize(void* p) noexcept -> size_t
+    {
+#if defined(_MSC_VER)
+        return _msize(p);
+#else
+        return malloc_usable_size(p);
+#endif
+    }
+
+    auto UsableSizeAligned(void* p, size_t alignment) noexcept -> size_t
+    {
+#if defined(_MSC_VER)
+        return _aligned_msize(p, alignment, 0);
+#else
+        (void)alignment;
+
+        return malloc_usable_size(p);
+#endif
+    }
+
+    auto Count(size_t size, size_t usable) noexcept -> void
+    {
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        gBytes.fetch_add(size, std::memory_order_relaxed);
+        gLiveBytes.fetch_add(static_cast<int64_t>(usable), std::memory_order_relaxed);
+    }
+
+    auto Uncount(size_t usable) noexcept -> void
+    {
+        gLiveBytes.fetch_sub(static_cast<int64_t>(usable), std::memory_order_relaxed);
+    }
+
+    auto Free(void* p) noexcept -> void
+    {
+        if (p == nullptr)
+            return;
+
+        Uncount(UsableSize(p));
+        std::free(p);
+    }
+
+    auto AllocateAligned(size_t size, size_t alignment) -> void*
+    {
+#if defined(_MSC_VER)
+        void* p = _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+        void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+        if (p == nullptr)
+            throw std::bad_alloc();
+
+        Count(size, UsableSizeAligned(p, alignment));
+
+        return p;
+    }
+
+    auto FreeAligned(void* p, size_t alignment) noexcept -> void
+    {
+        if (p == nullptr)
+            return;
+
+        Uncount(UsableSizeAligned(p, alignment));
+
+#if defined(_MSC_VER)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+auto ReflectMetaBench::CurrentAllocationStats() noexcept -> AllocationStats
+{
+    return AllocationStats{ gAllocations.load(std::memory_order_relaxed), gBytes.load(std::memory_order_relaxed), gLiveBytes.load(std::memory_order_relaxed) };
+}
+
+void* operator new(size_t size)
+{
+    void* p = std::malloc(size == 0 ? 1 : size);
+
+    if (p == nullptr)
+        throw std::bad_alloc();
+
+    Count(size, UsableSize(p));
+
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return AllocateAligned(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return AllocateAligned(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept
+{
+    Free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    Free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    Free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    Free(p);
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept
+{
+    FreeAligned(p, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* p, std::align_val_t alignment) noexcept
+{
+    FreeAligned(p, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p, size_t, std::align_val_t alignment) noexcept
+{
+    FreeAligned(p, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* p, size_t, std::align_val_t alignment) noexcept
+{
+    FreeAligned(p, static_cast<size_t>(alignment));
+}
+
+#pragma endregion
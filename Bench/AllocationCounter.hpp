@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ReflectMetaBench
+{
+    struct AllocationStats
+    {
+        uint64_t allocations;
+        uint64_t bytes;
+        int64_t liveBytes;
+    };
+
+    auto CurrentAllocationStats() noexcept -> AllocationStats;
+
+    inline auto operator-(const AllocationStats& a, const AllocationStats& b) noexcept -> AllocationStats
+    {
+        return AllocationStats{ a.allocations - b.allocations, a.bytes - b.bytes, a.liveBytes - b.liveBytes };
+    }
+}
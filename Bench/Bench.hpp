@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <string_view>
+#include <vector>
+
+namespace ReflectMetaBench
+{
+    struct Case
+    {
+        std::string_view name;
+        auto (*run)() -> void;
+    };
+
+    inline auto Cases() -> std::vector<Case>&
+    {
+        static std::vector<Case> cases;
+
+        return cases;
+    }
+
+    struct CaseRegistrar
+    {
+        CaseRegistrar(std::string_view name, auto (*run)() -> void)
+        {
+            Cases().push_back(Case{ name, run });
+        }
+    };
+
+    template <typename T>
+    inline auto DoNotOptimize(const T& value) -> void
+    {
+#if defined(_MSC_VER)
+        static const volatile void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    inline auto ClobberMemory() -> void
+    {
+#if defined(_MSC_VER)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    template <typename F>
+    auto Measure(std::string_view label, size_t iterations, F&& body) -> double
+    {
+        for (size_t i = 0; i < iterations / 16 + 1; ++i)
+            body();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < iterations; ++i)
+            body();
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+
+        std::println("  {:<56} {:>10.2f} ns/op", label, ns);
+
+        return ns;
+    }
+}
+
+#define REFLECT_META_BENCH_CONCAT_IMPL(a, b) a##b
+#define REFLECT_META_BENCH_CONCAT(a, b) REFLECT_META_BENCH_CONCAT_IMPL(a, b)
+#define REFLECT_META_BENCH(Name) static auto Name() -> void; static ::ReflectMetaBench::CaseRegistrar REFLECT_META_BENCH_CONCAT(gBenchCase_, Name){ #Name, &Name }; static auto Name() -> void
@@ -0,0 +1,130 @@
+#pragma region BenchTypes.Reflect.cpp
+
+#include "ReflectMeta/ReflectMeta.hpp"
+#include "BenchTypes.hpp"
+
+namespace ReflectMeta
+{
+    template <>
+    struct Reflect<::BenchVector3>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::BenchVector3>("::BenchVector3")
+                .Ctor<Access::PUBLIC, false, ::BenchVector3>()
+                .Ctor<Access::PUBLIC, false, ::BenchVector3, const ::BenchVector3&>()
+                .Ctor<Access::PUBLIC, false, ::BenchVector3, float>()
+                .Ctor<Access::PUBLIC, false, ::BenchVector3, float, float>()
+                .Ctor<Access::PUBLIC, false, ::BenchVector3, float, float, float>()
+                .Dtor<Access::PUBLIC, ::BenchVector3>()
+                .Member<Access::PUBLIC, float>("::BenchVector3::x", offsetof(::BenchVector3, x))
+                .Member<Access::PUBLIC, float>("::BenchVector3::y", offsetof(::BenchVector3, y))
+                .Member<Access::PUBLIC, float>("::BenchVector3::z", offsetof(::BenchVector3, z))
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::BenchVector3::Length>("::BenchVector3::Length")
+                .Method<Access::PUBLIC, Qualifiers::NOEXCEPT_, &::BenchVector3::Scale>("::BenchVector3::Scale")
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::BenchVector3::Components>("::BenchVector3::Components")
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::BenchEntity>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::BenchEntity>("::BenchEntity")
+                .Member<Access::PUBLIC, int>("::BenchEntity::id", Detail::MemberOffsetOf(&::BenchEntity::id))
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::BenchEntity::Tick>("::BenchEntity::Tick", true)
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::BenchTransform>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New().Struct<::BenchTransform>("::BenchTransform").Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::BenchActor>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::BenchActor>("::BenchActor")
+                .Base<Access::PUBLIC, ::BenchActor, ::BenchEntity>("::BenchEntity")
+                .Base<Access::PUBLIC, ::BenchActor, ::BenchTransform>("::BenchTransform")
+                .Member<Access::PUBLIC, int>("::BenchActor::health", Detail::MemberOffsetOf(&::BenchActor::health))
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::BenchPawn>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::BenchPawn>("::BenchPawn")
+                .Base<Access::PUBLIC, ::BenchPawn, ::BenchActor>("::BenchActor")
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::BenchCharacter>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::BenchCharacter>("::BenchCharacter")
+                .Base<Access::PUBLIC, ::BenchCharacter, ::BenchPawn>("::BenchPawn")
+                .Member<Access::PUBLIC, float>("::BenchCharacter::speed", Detail::MemberOffsetOf(&::BenchCharacter::speed))
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::BenchCharacter::Tick>("::BenchCharacter::Tick", true)
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchVector3>
+    {
+        inline static bool done = RegisterReflected<::BenchVector3>("::BenchVector3");
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchEntity>
+    {
+        inline static bool done = RegisterReflected<::BenchEntity>("::BenchEntity");
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchTransform>
+    {
+        inline static bool done = RegisterReflected<::BenchTransform>("::BenchTransform");
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchActor>
+    {
+        inline static bool done = RegisterReflected<::BenchActor>("::BenchActor");
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchPawn>
+    {
+        inline static bool done = RegisterReflected<::BenchPawn>("::BenchPawn");
+    };
+
+    template <>
+    struct Reflect_Impl<::BenchCharacter>
+    {
+        inline static bool done = RegisterReflected<::BenchCharacter>("::BenchCharacter");
+    };
+}
+
+#pragma endregion
@@ -0,0 +1,98 @@
+#pragma region BenchTypes.hpp
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "ReflectMeta/ReflectMeta.hpp"
+
+class BenchVector3
+{
+
+public:
+
+    float x;
+    float y;
+    float z;
+
+    BenchVector3() = default;
+
+    BenchVector3(float x, float y = 0.0f, float z = 0.0f) : x(x), y(y), z(z) { }
+
+    float Length() const
+    {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    void Scale(float factor) noexcept
+    {
+        x *= factor;
+        y *= factor;
+        z *= factor;
+    }
+
+    std::vector<float> Components() const
+    {
+        return { x, y, z };
+    }
+
+};
+
+class BenchEntity
+{
+
+public:
+
+    int id = 0;
+
+    virtual ~BenchEntity() = default;
+
+    virtual int Tick(int delta)
+    {
+        return id + delta;
+    }
+
+};
+
+class BenchTransform
+{
+
+public:
+
+    float position[3] = {};
+
+};
+
+class BenchActor : public BenchEntity, public BenchTransform
+{
+
+public:
+
+    int health = 100;
+
+};
+
+class BenchPawn : public BenchActor
+{
+
+public:
+
+    int controller = 0;
+
+};
+
+class BenchCharacter final : public BenchPawn
+{
+
+public:
+
+    float speed = 1.0f;
+
+    int Tick(int delta) override
+    {
+        return static_cast<int>(speed) * delta;
+    }
+
+};
+
+#pragma endregion
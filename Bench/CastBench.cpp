@@ -0,0 +1,145 @@
+#pragma region CastBench.cpp
+
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+namespace
+{
+    auto WalkBases(void* obj, const TypeDesc& from, TypeId to) -> void*
+    {
+        if (from.id == to)
+            return obj;
+
+        for (const BaseDesc& b : from.bases)
+        {
+            const TypeDesc* base = Registry::Instance().Find(b.baseTypeId);
+
+            if (base == nullptr)
+                continue;
+
+            if (void* hit = WalkBases(b.adjustPtr(obj), *base, to))
+                return hit;
+        }
+
+        return nullptr;
+    }
+
+    auto WalkIsDerived(const TypeDesc& from, TypeId to) -> bool
+    {
+        if (from.id == to)
+            return true;
+
+        for (const BaseDesc& b : from.bases)
+        {
+            const TypeDesc* base = Registry::Instance().Find(b.baseTypeId);
+
+            if (base != nullptr && WalkIsDerived(*base, to))
+                return true;
+        }
+
+        return false;
+    }
+}
+
+REFLECT_META_BENCH(Upcast)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    Registry& registry = Registry::Instance();
+
+    const TypeDesc* character = registry.Get<::BenchCharacter>();
+    const TypeDesc* transform = registry.Get<::BenchTransform>();
+    ::BenchCharacter object;
+    void* p = &object;
+
+    Measure("static_cast<BenchTransform*> (3 levels)", iterations, [&]
+        {
+            DoNotOptimize(p);
+            ::BenchTransform* out = static_cast<::BenchCharacter*>(p);
+            DoNotOptimize(out);
+        });
+
+    Measure("walk BaseDesc + Registry::Find + adjustPtr (3 levels)", iterations, [&]
+        {
+            DoNotOptimize(p);
+            void* out = WalkBases(p, *character, transform->id);
+            DoNotOptimize(out);
+        });
+
+    Measure("Registry::CastTo ancestor table (3 levels)", iterations, [&]
+        {
+            DoNotOptimize(p);
+            void* out = registry.CastTo(p, *character, *transform);
+            DoNotOptimize(out);
+        });
+}
+
+REFLECT_META_BENCH(Subtype)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    Registry& registry = Registry::Instance();
+
+    const TypeDesc* character = registry.Get<::BenchCharacter>();
+    const TypeDesc* actor = registry.Get<::BenchActor>();
+    const TypeDesc* pawn = registry.Get<::BenchPawn>();
+    const TypeDesc* transform = registry.Get<::BenchTransform>();
+    ::BenchCharacter characterObject;
+    ::BenchActor actorObject;
+    ::BenchEntity* hit = &characterObject;
+    ::BenchEntity* miss = &actorObject;
+
+    Measure("dynamic_cast<BenchPawn*> (hit)", iterations, [&]
+        {
+            DoNotOptimize(hit);
+            bool out = dynamic_cast<::BenchPawn*>(hit) != nullptr;
+            DoNotOptimize(out);
+        });
+
+    Measure("dynamic_cast<BenchTransform*> (cross-cast hit)", iterations, [&]
+        {
+            DoNotOptimize(hit);
+            bool out = dynamic_cast<::BenchTransform*>(hit) != nullptr;
+            DoNotOptimize(out);
+        });
+
+    Measure("dynamic_cast<BenchCharacter*> (miss)", iterations, [&]
+        {
+            DoNotOptimize(miss);
+            bool out = dynamic_cast<::BenchCharacter*>(miss) != nullptr;
+            DoNotOptimize(out);
+        });
+
+    Measure("walk BaseDesc + Registry::Find (BenchTransform hit)", iterations, [&]
+        {
+            DoNotOptimize(character);
+            bool out = WalkIsDerived(*character, transform->id);
+            DoNotOptimize(out);
+        });
+
+    Measure("walk BaseDesc + Registry::Find (miss)", iterations, [&]
+        {
+            DoNotOptimize(actor);
+            bool out = WalkIsDerived(*actor, pawn->id);
+            DoNotOptimize(out);
+        });
+
+    Measure("Registry::IsA (BenchTransform hit)", iterations, [&]
+        {
+            DoNotOptimize(character);
+            bool out = registry.IsA(*character, *transform);
+            DoNotOptimize(out);
+        });
+
+    Measure("Registry::IsA (miss)", iterations, [&]
+        {
+            DoNotOptimize(actor);
+            bool out = registry.IsA(*actor, *pawn);
+            DoNotOptimize(out);
+        });
+}
+
+#pragma endregion
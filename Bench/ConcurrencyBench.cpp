@@ -0,0 +1,128 @@
+#pragma region ConcurrencyBench.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+namespace
+{
+    struct SyntheticTypes
+    {
+        std::deque<std::string> names;
+        std::deque<TypeDesc> descs;
+
+        auto Add(size_t count, std::string_view prefix) -> void
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string& name = names.emplace_back(std::string(prefix) + std::to_string(descs.size()));
+
+                descs.push_back(TypeHierarchy::New().Struct<::BenchVector3>(name).Commit());
+            }
+        }
+    };
+}
+
+REFLECT_META_BENCH(RegistryConcurrentReads)
+{
+    constexpr size_t baseTypes = 2048;
+    constexpr size_t writerBatch = 32;
+    constexpr auto roundTime = std::chrono::milliseconds(250);
+
+    Registry& registry = Registry::Instance();
+    registry.EnableConcurrentReads();
+
+    SyntheticTypes base;
+    base.Add(baseTypes, "::BenchConcurrent::Base");
+
+    {
+        Registry::Batch batch(registry);
+
+        for (const TypeDesc& d : base.descs)
+            registry.RegisterRange(&d, &d + 1);
+    }
+
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    SyntheticTypes late;
+    late.Add(writerBatch * 64 * 8, "::BenchConcurrent::Late");
+    size_t lateCursor = 0;
+
+    for (unsigned threads = 1; threads <= hardwareThreads; threads *= 2)
+    {
+        std::atomic<bool> stop = false;
+        std::atomic<uint64_t> totalReads = 0;
+        std::atomic<uint64_t> misses = 0;
+
+        std::vector<std::thread> readers;
+
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            readers.emplace_back([&, t]
+                {
+                    uint64_t reads = 0;
+                    uint64_t localMisses = 0;
+                    size_t cursor = t * 7919;
+
+                    while (!stop.load(std::memory_order_relaxed))
+                    {
+                        for (int i = 0; i < 256; ++i)
+                        {
+                            const TypeDesc& d = base.descs[cursor++ % baseTypes];
+
+                            if (registry.FindByQualifiedName(d.qualifiedName) != &d)
+                                ++localMisses;
+                        }
+
+                        reads += 256;
+                    }
+
+                    totalReads += reads;
+                    misses += localMisses;
+                });
+        }
+
+        std::thread writer([&]
+            {
+                while (!stop.load(std::memory_order_relaxed) && lateCursor + writerBatch <= late.descs.size())
+                {
+                    {
+                        Registry::Batch batch(registry);
+
+                        for (size_t i = 0; i < writerBatch; ++i, ++lateCursor)
+                            registry.RegisterRange(&late.descs[lateCursor], &late.descs[lateCursor] + 1);
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                }
+            });
+
+        std::this_thread::sleep_for(roundTime);
+        stop = true;
+
+        for (std::thread& r : readers)
+            r.join();
+
+        writer.join();
+
+        const size_t retiredSnapshots = registry.RetiredSnapshots();
+
+        registry.ReclaimRetired();
+
+        const double seconds = std::chrono::duration<double>(roundTime).count();
+        const double mops = static_cast<double>(totalReads.load()) / seconds / 1e6;
+
+        std::println("  {:>3} reader threads: {:>10.2f} Mlookups/s total, {:>8.2f} per thread, {} misses, {} types registered, {} snapshots awaiting reclamation", threads, mops, mops / threads, misses.load(), baseTypes + lateCursor, retiredSnapshots);
+    }
+}
+
+#pragma endregion
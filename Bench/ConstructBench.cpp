@@ -0,0 +1,199 @@
+#pragma region ConstructBench.cpp
+
+#include <new>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+REFLECT_META_BENCH(Construct)
+{
+    constexpr size_t iterations = 5'000'000;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassTypeErased vectorClass{ desc };
+
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+    void* args[] = { &x, &y, &z };
+    const std::type_info* argTypes[] = { &typeid(float), &typeid(float), &typeid(float) };
+
+    const CtorHandle handle = vectorClass.GetCtor<float, float, float>();
+
+    auto release = [](void* p)
+        {
+            ::operator delete(p, std::align_val_t(alignof(::BenchVector3)));
+        };
+
+    Measure("direct new BenchVector3(x, y, z)", iterations, [&]
+        {
+            ::BenchVector3* p = new ::BenchVector3(x, y, z);
+            DoNotOptimize(p);
+            delete p;
+        });
+
+    Measure("Registry::New(name, args, 3, argTypes)", iterations, [&]
+        {
+            void* p = Registry::Instance().New("::BenchVector3", args, 3, argTypes);
+            DoNotOptimize(p);
+            release(p);
+        });
+
+    Measure("ClassTypeErased::New(args, 3, argTypes)", iterations, [&]
+        {
+            void* p = vectorClass.New(args, 3, argTypes);
+            DoNotOptimize(p);
+            release(p);
+        });
+
+    Measure("CtorHandle::New(args)", iterations, [&]
+        {
+            void* p = handle.New(args);
+            DoNotOptimize(p);
+            release(p);
+        });
+
+    alignas(::BenchVector3) std::byte storage[sizeof(::BenchVector3)];
+
+    Measure("ClassTypeErased::ConstructInto(storage, args, 3, types)", iterations, [&]
+        {
+            vectorClass.ConstructInto(storage, args, 3, argTypes);
+            ClobberMemory();
+        });
+
+    Measure("CtorHandle::ConstructInto(storage, args)", iterations, [&]
+        {
+            handle.ConstructInto(storage, args);
+            ClobberMemory();
+        });
+}
+
+REFLECT_META_BENCH(ConstructArray)
+{
+    constexpr size_t count = 100'000;
+    constexpr size_t iterations = 200;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassTypeErased vectorClass{ desc };
+
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+    void* args[] = { &x, &y, &z };
+    const std::type_info* argTypes[] = { &typeid(float), &typeid(float), &typeid(float) };
+
+    const CtorHandle defaultCtor = vectorClass.GetCtor<>();
+    const CtorHandle valueCtor = vectorClass.GetCtor<float, float, float>();
+
+    std::vector<::BenchVector3> storage(count);
+
+    Measure("ConstructInto loop, default ctor (100k)", iterations, [&]
+        {
+            for (::BenchVector3& v : storage)
+                vectorClass.ConstructInto(&v, nullptr, 0, nullptr);
+
+            ClobberMemory();
+        });
+
+    Measure("ConstructArray, default ctor memset (100k)", iterations, [&]
+        {
+            vectorClass.ConstructArray(storage.data(), count, defaultCtor, nullptr);
+            ClobberMemory();
+        });
+
+    Measure("ConstructInto loop, (float, float, float) (100k)", iterations, [&]
+        {
+            for (::BenchVector3& v : storage)
+                vectorClass.ConstructInto(&v, args, 3, argTypes);
+
+            ClobberMemory();
+        });
+
+    Measure("ConstructArray, (float, float, float) (100k)", iterations, [&]
+        {
+            vectorClass.ConstructArray(storage.data(), count, valueCtor, args);
+            ClobberMemory();
+        });
+
+    const DtorDesc& dtor = *desc->destructor;
+
+    Measure("erased dtor loop (100k)", iterations, [&]
+        {
+            for (::BenchVector3& v : storage)
+                dtor.erasedDtor(&v);
+
+            ClobberMemory();
+        });
+
+    Measure("DestroyArray, trivially destructible (100k)", iterations, [&]
+        {
+            vectorClass.DestroyArray(storage.data(), count);
+            ClobberMemory();
+        });
+}
+
+REFLECT_META_BENCH(CloneAndRelocate)
+{
+    constexpr size_t count = 100'000;
+    constexpr size_t iterations = 200;
+
+    ClassTypeErased vectorClass{ Registry::Instance().Get("::BenchVector3") };
+
+    std::vector<::BenchVector3> source(count, ::BenchVector3{ 1.0f, 2.0f, 3.0f });
+    std::vector<::BenchVector3> target(count);
+
+    const ValueOps& ops = vectorClass.GetDesc()->valueOps;
+
+    Measure("BenchVector3 copy thunk per element (100k)", iterations, [&]
+        {
+            for (size_t i = 0; i < count; ++i)
+                ops.copyConstruct(&target[i], &source[i], 1);
+
+            ClobberMemory();
+        });
+
+    Measure("BenchVector3 CopyConstruct, trivially copyable (100k)", iterations, [&]
+        {
+            vectorClass.CopyConstruct(target.data(), source.data(), count);
+            ClobberMemory();
+        });
+
+    const TypeDesc* stringDesc = Registry::Instance().Register(TypeHierarchy::New().Struct<std::string>("::BenchValueOps::String")
+        .Dtor<Access::PUBLIC, std::string>()
+        .Commit());
+    ClassTypeErased stringClass{ stringDesc };
+
+    constexpr size_t stringCount = 10'000;
+
+    std::vector<std::string> strings(stringCount, std::string(64, 'x'));
+    std::allocator<std::string> allocator;
+    std::string* from = allocator.allocate(stringCount);
+    std::string* to = allocator.allocate(stringCount);
+
+    std::uninitialized_copy_n(strings.data(), stringCount, from);
+
+    Measure("std::string MoveConstruct + DestroyArray (10k)", iterations, [&]
+        {
+            stringClass.MoveConstruct(to, from, stringCount);
+            stringClass.DestroyArray(from, stringCount);
+            std::swap(from, to);
+            ClobberMemory();
+        });
+
+    Measure("std::string Relocate thunk (10k)", iterations, [&]
+        {
+            stringClass.Relocate(to, from, stringCount);
+            std::swap(from, to);
+            ClobberMemory();
+        });
+
+    std::destroy_n(from, stringCount);
+    allocator.deallocate(from, stringCount);
+    allocator.deallocate(to, stringCount);
+}
+
+#pragma endregion
@@ -0,0 +1,222 @@
+#pragma region InvokeBench.cpp
+
+#include <memory>
+#include <new>
+#include <vector>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+REFLECT_META_BENCH(MethodInvoke)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassType<::BenchVector3> vectorClass{ desc };
+    ::BenchVector3 v{ 1.0f, 2.0f, 3.0f };
+
+    auto scaleTyped = vectorClass.GetMethodCT<"Scale", void, float>();
+    auto lengthTyped = vectorClass.GetMethodCT<"Length", float>();
+    auto scaleErased = vectorClass.GetMethod(true, "Scale");
+    auto lengthErased = vectorClass.GetMethod(true, "Length");
+
+    Measure("direct v.Scale(f)", iterations, [&]
+        {
+            float factor = 1.0f;
+            DoNotOptimize(factor);
+            v.Scale(factor);
+            ClobberMemory();
+        });
+
+    Measure("MethodTypeTyped Scale.Invoke(v, f)", iterations, [&]
+        {
+            float factor = 1.0f;
+            DoNotOptimize(factor);
+            scaleTyped.Invoke(v, factor);
+            ClobberMemory();
+        });
+
+    Measure("MethodTypeErased Scale.Invoke(&v, args, nullptr)", iterations, [&]
+        {
+            float factor = 1.0f;
+            void* args[] = { &factor };
+            scaleErased.Invoke(&v, args, nullptr);
+            ClobberMemory();
+        });
+
+    Measure("direct v.Length()", iterations, [&]
+        {
+            ClobberMemory();
+            float out = v.Length();
+            DoNotOptimize(out);
+        });
+
+    Measure("MethodTypeTyped Length.Invoke(v)", iterations, [&]
+        {
+            ClobberMemory();
+            float out = lengthTyped.Invoke(v);
+            DoNotOptimize(out);
+        });
+
+    Measure("MethodTypeErased Length.Invoke(&v, nullptr, &out)", iterations, [&]
+        {
+            ClobberMemory();
+            float out = 0.0f;
+            lengthErased.Invoke(&v, nullptr, &out);
+            DoNotOptimize(out);
+        });
+}
+
+REFLECT_META_BENCH(MethodInvokeBatch)
+{
+    constexpr size_t objectCount = 200'000;
+    constexpr size_t iterations = 20;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassType<::BenchVector3> vectorClass{ desc };
+    auto scaleErased = vectorClass.GetMethod(true, "Scale");
+    auto lengthErased = vectorClass.GetMethod(true, "Length");
+
+    std::vector<::BenchVector3> objects(objectCount, ::BenchVector3{ 1.0f, 2.0f, 3.0f });
+    std::vector<void*> objectPointers(objectCount);
+    std::vector<float> lengths(objectCount);
+
+    for (size_t i = 0; i < objectCount; ++i)
+        objectPointers[i] = &objects[i];
+
+    float factor = 1.0f;
+    void* scaleArgs[] = { &factor };
+
+    Measure("direct Scale loop (200k objects)", iterations, [&]
+        {
+            for (::BenchVector3& v : objects)
+                v.Scale(factor);
+
+            ClobberMemory();
+        });
+
+    Measure("erased Scale.Invoke per object (200k objects)", iterations, [&]
+        {
+            for (::BenchVector3& v : objects)
+                scaleErased.Invoke(&v, scaleArgs, nullptr);
+
+            ClobberMemory();
+        });
+
+    Measure("Scale.InvokeBatch base+stride, broadcast arg (200k objects)", iterations, [&]
+        {
+            scaleErased.InvokeBatch(objects.data(), sizeof(::BenchVector3), objects.size(), scaleArgs, nullptr, nullptr, 0);
+            ClobberMemory();
+        });
+
+    Measure("Scale.InvokeBatch pointer span (200k objects)", iterations, [&]
+        {
+            scaleErased.InvokeBatch(objectPointers, scaleArgs, nullptr, nullptr, 0);
+            ClobberMemory();
+        });
+
+    Measure("erased Length.Invoke per object (200k objects)", iterations, [&]
+        {
+            for (size_t i = 0; i < objectCount; ++i)
+                lengthErased.Invoke(&objects[i], nullptr, &lengths[i]);
+
+            ClobberMemory();
+        });
+
+    Measure("Length.InvokeBatch strided returns (200k objects)", iterations, [&]
+        {
+            lengthErased.InvokeBatch(objects.data(), sizeof(::BenchVector3), objects.size(), nullptr, nullptr, lengths.data(), sizeof(float));
+            ClobberMemory();
+        });
+}
+
+REFLECT_META_BENCH(MethodInvokeReturnSlot)
+{
+    constexpr size_t iterations = 2'000'000;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassType<::BenchVector3> vectorClass{ desc };
+    auto componentsErased = vectorClass.GetMethod(true, "Components");
+    ::BenchVector3 v{ 1.0f, 2.0f, 3.0f };
+
+    Measure("direct v.Components()", iterations, [&]
+        {
+            ClobberMemory();
+            std::vector<float> out = v.Components();
+            DoNotOptimize(out.data());
+        });
+
+    Measure("Invoke into default-constructed std::vector (assign)", iterations, [&]
+        {
+            ClobberMemory();
+            std::vector<float> out;
+            componentsErased.Invoke(&v, nullptr, &out);
+            DoNotOptimize(out.data());
+        });
+
+    Measure("InvokeInto raw storage (placement construct)", iterations, [&]
+        {
+            ClobberMemory();
+            alignas(std::vector<float>) std::byte storage[sizeof(std::vector<float>)];
+            componentsErased.InvokeInto(&v, nullptr, storage);
+            std::vector<float>* out = std::launder(reinterpret_cast<std::vector<float>*>(storage));
+            DoNotOptimize(out->data());
+            std::destroy_at(out);
+        });
+}
+
+REFLECT_META_BENCH(VirtualDispatch)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    Registry& registry = Registry::Instance();
+
+    const TypeDesc* entity = registry.Get<::BenchEntity>();
+    const TypeDesc* character = registry.Get<::BenchCharacter>();
+    ::BenchCharacter object;
+    ::BenchEntity* base = &object;
+
+    const VirtualSlot tickSlot = registry.SlotOf(*entity, "Tick");
+
+    Measure("direct base->Tick(d)", iterations, [&]
+        {
+            int delta = 1;
+            DoNotOptimize(base);
+            DoNotOptimize(delta);
+            int out = base->Tick(delta);
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMethod(\"Tick\") on the dynamic type + Invoke", iterations, [&]
+        {
+            int delta = 1;
+            void* args[] = { &delta };
+            int out = 0;
+            ClassTypeErased(character).GetMethod(true, "Tick").Invoke(base, args, &out);
+            DoNotOptimize(out);
+        });
+
+    const MethodTypeErased resolved = ClassTypeErased(character).GetMethod(true, "Tick");
+
+    Measure("pre-resolved MethodTypeErased Invoke", iterations, [&]
+        {
+            int delta = 1;
+            void* args[] = { &delta };
+            int out = 0;
+            resolved.Invoke(base, args, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("Registry::InvokeSlot(obj, dynamicType, slot)", iterations, [&]
+        {
+            int delta = 1;
+            void* args[] = { &delta };
+            int out = 0;
+            registry.InvokeSlot(base, *character, tickSlot, args, &out);
+            DoNotOptimize(out);
+        });
+}
+
+#pragma endregion
@@ -0,0 +1,105 @@
+#pragma region LookupBench.cpp
+
+#include <optional>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+REFLECT_META_BENCH(MemberLookup)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    const TypeDesc* desc = Registry::Instance().Get("::BenchVector3");
+    ClassType<::BenchVector3> vectorClass{ desc };
+    ::BenchVector3 v{ 1.0f, 2.0f, 3.0f };
+
+    Measure("direct member read", iterations, [&]
+        {
+            ClobberMemory();
+            float out = v.y;
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMember(\"y\") + GetAny", iterations, [&]
+        {
+            float out = 0.0f;
+            vectorClass.GetMember(true, "y").GetAny(&v, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMember(\"::BenchVector3::y\") + GetAny", iterations, [&]
+        {
+            float out = 0.0f;
+            vectorClass.GetMember(true, "::BenchVector3::y").GetAny(&v, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMemberCT<\"y\">() + GetAny", iterations, [&]
+        {
+            float out = 0.0f;
+            vectorClass.GetMemberCT<"y">().GetAny(&v, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMethodCT<\"Scale\">() resolve", iterations, [&]
+        {
+            auto m = vectorClass.GetMethodCT<"Scale", void, float>();
+            DoNotOptimize(m);
+        });
+}
+
+namespace
+{
+    auto FindMemberByWalking(const TypeDesc& t, std::string_view name, ptrdiff_t offset) -> std::optional<MemberTypeErased>
+    {
+        if (const FieldDesc* f = FindField(t, true, name))
+            return MemberTypeErased(f->name, f->type, static_cast<size_t>(offset) + f->offsetInBytes);
+
+        for (const BaseDesc& b : t.bases)
+        {
+            const TypeDesc* base = Registry::Instance().Find(b.baseTypeId);
+
+            if (base == nullptr)
+                continue;
+
+            if (std::optional<MemberTypeErased> hit = FindMemberByWalking(*base, name, offset + static_cast<ptrdiff_t>(b.offsetInBytes)))
+                return hit;
+        }
+
+        return std::nullopt;
+    }
+}
+
+REFLECT_META_BENCH(InheritedMemberLookup)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    const TypeDesc* desc = Registry::Instance().Get<::BenchCharacter>();
+    ClassTypeErased characterClass{ desc };
+    ::BenchCharacter character;
+
+    Measure("GetMember(\"speed\") own + GetAny", iterations, [&]
+        {
+            float out = 0.0f;
+            characterClass.GetMember(true, "speed").GetAny(&character, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("walk bases + FindField(\"id\") + GetAny (3 levels)", iterations, [&]
+        {
+            int out = 0;
+            FindMemberByWalking(*desc, "id", 0)->GetAny(&character, &out);
+            DoNotOptimize(out);
+        });
+
+    Measure("GetMember(\"id\") flattened view + GetAny (3 levels)", iterations, [&]
+        {
+            int out = 0;
+            characterClass.GetMember(true, "id").GetAny(&character, &out);
+            DoNotOptimize(out);
+        });
+}
+
+#pragma endregion
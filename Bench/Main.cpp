@@ -0,0 +1,23 @@
+#pragma region Main.cpp
+
+#include <print>
+#include <string_view>
+#include "Bench.hpp"
+
+int main(int argc, char** argv)
+{
+    const std::string_view filter = argc > 1 ? std::string_view(argv[1]) : std::string_view();
+
+    for (const ReflectMetaBench::Case& c : ReflectMetaBench::Cases())
+    {
+        if (!filter.empty() && c.name.find(filter) == std::string_view::npos)
+            continue;
+
+        std::println("{}", c.name);
+        c.run();
+    }
+
+    return 0;
+}
+
+#pragma endregion
@@ -0,0 +1,100 @@
+#pragma region PoolBench.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+namespace
+{
+    auto RegisterChurnType(std::string_view name, bool pooled) -> const TypeDesc*
+    {
+        TypeHierarchy h = TypeHierarchy::New();
+
+        h.Struct<::BenchVector3>(name)
+            .Ctor<Access::PUBLIC, false, ::BenchVector3, float, float, float>()
+            .Dtor<Access::PUBLIC, ::BenchVector3>();
+
+        if (pooled)
+            h.Pooled();
+
+        return Registry::Instance().Register(h.Commit());
+    }
+
+    auto Churn(const TypeDesc* desc, unsigned threads, size_t operationsPerThread) -> double
+    {
+        constexpr size_t liveObjects = 1024;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([=]
+                {
+                    ClassTypeErased type{ desc };
+                    const CtorHandle ctor = type.GetCtor<float, float, float>();
+
+                    float x = 1.0f;
+                    float y = 2.0f;
+                    float z = 3.0f;
+                    void* args[] = { &x, &y, &z };
+
+                    std::vector<void*> live(liveObjects);
+
+                    for (void*& p : live)
+                        p = ctor.New(args);
+
+                    size_t cursor = t;
+
+                    for (size_t i = 0; i < operationsPerThread; ++i)
+                    {
+                        cursor = (cursor * 1103515245u + 12345u) & (liveObjects - 1);
+
+                        type.Delete(live[cursor]);
+                        live[cursor] = ctor.New(args);
+                    }
+
+                    for (void* p : live)
+                        type.Delete(p);
+                });
+        }
+
+        for (std::thread& w : workers)
+            w.join();
+
+        const auto stop = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operationsPerThread * threads);
+    }
+}
+
+REFLECT_META_BENCH(PooledAllocationChurn)
+{
+    constexpr size_t operationsPerThread = 2'000'000;
+
+    const TypeDesc* global = RegisterChurnType("::BenchChurn::Global", false);
+    const TypeDesc* pooled = RegisterChurnType("::BenchChurn::Pooled", true);
+
+    const unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        const double globalNs = Churn(global, threads, operationsPerThread);
+        const double pooledNs = Churn(pooled, threads, operationsPerThread);
+
+        std::println("  {:>3} threads: global operator new {:>8.2f} ns/op, pooled {:>8.2f} ns/op (Delete + New per op)", threads, globalNs, pooledNs);
+    }
+
+    const ObjectPool::Stats stats = *Registry::Instance().GetPoolStats("::BenchChurn::Pooled");
+
+    std::println("  pool: {} byte slots, {} pages, {} slots, {} outstanding", stats.slotSize, stats.pages, stats.capacity, stats.outstanding);
+}
+
+#pragma endregion
@@ -0,0 +1,57 @@
+#pragma region RegistrationBench.cpp
+
+#include <chrono>
+#include <deque>
+#include <string>
+#include "AllocationCounter.hpp"
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+REFLECT_META_BENCH(RegistrationAllocations)
+{
+    constexpr size_t typeCount = 10'000;
+
+    std::deque<std::string> names;
+
+    for (size_t i = 0; i < typeCount; ++i)
+        names.emplace_back("::BenchRegistration::Type" + std::to_string(i));
+
+    const AllocationStats before = CurrentAllocationStats();
+    const size_t arenaBefore = DescriptorArena::Module().BytesUsed();
+    const auto start = std::chrono::steady_clock::now();
+
+    {
+        Registry::Batch batch(Registry::Instance());
+
+        for (const std::string& name : names)
+        {
+            Registry::Instance().Register(TypeHierarchy::New().Struct<::BenchVector3>(name)
+                .Ctor<Access::PUBLIC, false, ::BenchVector3>()
+                .Dtor<Access::PUBLIC, ::BenchVector3>()
+                .Member<Access::PUBLIC, float>("::BenchVector3::x", offsetof(::BenchVector3, x))
+                .Member<Access::PUBLIC, float>("::BenchVector3::y", offsetof(::BenchVector3, y))
+                .Member<Access::PUBLIC, float>("::BenchVector3::z", offsetof(::BenchVector3, z))
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::BenchVector3::Length>("::BenchVector3::Length")
+                .Method<Access::PUBLIC, Qualifiers::NOEXCEPT_, &::BenchVector3::Scale>("::BenchVector3::Scale")
+                .Commit());
+        }
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+    const AllocationStats used = CurrentAllocationStats() - before;
+
+    std::println("  {} types: {} allocations ({:.2f} per type), {} bytes requested ({:.1f} per type), {:.2f} ms",
+        typeCount, used.allocations, static_cast<double>(used.allocations) / typeCount, used.bytes, static_cast<double>(used.bytes) / typeCount,
+        std::chrono::duration<double, std::milli>(stop - start).count());
+
+    const size_t arenaUsed = DescriptorArena::Module().BytesUsed() - arenaBefore;
+
+    std::println("  descriptor arena: {} bytes used, {} bytes reserved", DescriptorArena::Module().BytesUsed(), DescriptorArena::Module().BytesReserved());
+    std::println("  resident after registration: {} live heap bytes ({:.1f} per type), of which {:.1f} per type is descriptor arena payload",
+        used.liveBytes, static_cast<double>(used.liveBytes) / typeCount, static_cast<double>(arenaUsed) / typeCount);
+}
+
+#pragma endregion
@@ -0,0 +1,84 @@
+#pragma region RegistryBench.cpp
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include "Bench.hpp"
+#include "BenchTypes.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+REFLECT_META_BENCH(TypeLookup)
+{
+    constexpr size_t iterations = 10'000'000;
+
+    Registry& registry = Registry::Instance();
+
+    Measure("Get<T>() (static slot)", iterations, [&]
+        {
+            DoNotOptimize(registry.Get<::BenchVector3>());
+        });
+
+    Measure("Get(std::type_index) (two hash probes)", iterations, [&]
+        {
+            DoNotOptimize(registry.Get(std::type_index(typeid(::BenchVector3))));
+        });
+
+    Measure("FindByQualifiedName(\"::BenchVector3\")", iterations, [&]
+        {
+            DoNotOptimize(registry.FindByQualifiedName("::BenchVector3"));
+        });
+
+    Measure("Get(\"BenchVector3\") (simple name)", iterations, [&]
+        {
+            DoNotOptimize(registry.Get("BenchVector3"));
+        });
+}
+
+REFLECT_META_BENCH(TypeIdScale)
+{
+    constexpr size_t typeCount = 100'000;
+
+    std::vector<std::string> names;
+
+    for (size_t i = 0; i < typeCount; ++i)
+        names.push_back("::Game::Module" + std::to_string(i % 97) + "::Type" + std::to_string(i));
+
+    size_t cursor = 0;
+
+    Measure("TypeIdOf(runtime name)", typeCount * 10, [&]
+        {
+            DoNotOptimize(TypeIdOf(names[cursor]));
+            cursor = cursor + 1 == typeCount ? 0 : cursor + 1;
+        });
+
+    std::vector<TypeId> ids;
+    std::unordered_map<TypeId, size_t, TypeId::Hash> byId;
+
+    for (const std::string& name : names)
+        byId.emplace(ids.emplace_back(TypeIdOf(name)), byId.size());
+
+    size_t longestChain = 0;
+    size_t usedBuckets = 0;
+
+    for (size_t b = 0; b < byId.bucket_count(); ++b)
+    {
+        longestChain = std::max(longestChain, byId.bucket_size(b));
+        usedBuckets += byId.bucket_size(b) != 0;
+    }
+
+    std::println("  {} ids: {} distinct, {} buckets, {} used (ideal {:.0f}), longest chain {}", typeCount, byId.size(), byId.bucket_count(), usedBuckets,
+        static_cast<double>(byId.bucket_count()) * (1.0 - std::exp(-static_cast<double>(typeCount) / static_cast<double>(byId.bucket_count()))), longestChain);
+
+    Measure("unordered_map<TypeId>::find (100k ids)", typeCount * 10, [&]
+        {
+            DoNotOptimize(byId.find(ids[cursor]));
+            cursor = cursor + 1 == typeCount ? 0 : cursor + 1;
+        });
+}
+
+#pragma endregion
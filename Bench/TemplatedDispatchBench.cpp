@@ -0,0 +1,137 @@
+#pragma region TemplatedDispatchBench.cpp
+
+#include <string>
+#include <utility>
+#include "ReflectMeta/ReflectMeta.hpp"
+#include "Bench.hpp"
+
+using namespace ReflectMeta;
+using namespace ReflectMetaBench;
+
+namespace
+{
+    template <size_t I>
+    struct DispatchTag
+    {
+        static constexpr size_t value = I;
+    };
+
+    template <size_t... I>
+    auto MakeTagList(std::index_sequence<I...>) -> TypeList<DispatchTag<I>...>;
+
+    template <size_t N>
+    using TagList = decltype(MakeTagList(std::make_index_sequence<N>{}));
+
+    template <typename List>
+    struct LinearTypeSwitch;
+
+    template <typename... Ts>
+    struct LinearTypeSwitch<TypeList<Ts...>>
+    {
+        template <typename F>
+        static auto Apply(const std::type_info& id, F&& f) noexcept -> bool
+        {
+            bool matched = false;
+            ((id == typeid(Ts) ? (f.template operator() < Ts > (), matched = true) : false) || ...);
+            return matched;
+        }
+    };
+
+    struct Accumulate
+    {
+        size_t* sum;
+
+        template <typename T>
+        auto operator()() const noexcept -> void
+        {
+            *sum += T::value;
+        }
+    };
+
+    template <size_t N>
+    auto MeasureListLength() -> void
+    {
+        constexpr size_t iterations = 5'000'000;
+
+        using List = TagList<N>;
+
+        const std::type_info* last = &typeid(DispatchTag<N - 1>);
+        const std::type_info* missing = &typeid(DispatchTag<N>);
+        size_t sum = 0;
+
+        Measure(std::to_string(N) + " types: linear fold, last entry", iterations, [&]
+            {
+                DoNotOptimize(last);
+                LinearTypeSwitch<List>::Apply(*last, Accumulate{ &sum });
+            });
+
+        Measure(std::to_string(N) + " types: TypeSwitch, last entry", iterations, [&]
+            {
+                DoNotOptimize(last);
+                TypeSwitch<List>::Apply(*last, Accumulate{ &sum });
+            });
+
+        Measure(std::to_string(N) + " types: linear fold, unsupported type", iterations, [&]
+            {
+                DoNotOptimize(missing);
+                LinearTypeSwitch<List>::Apply(*missing, Accumulate{ &sum });
+            });
+
+        Measure(std::to_string(N) + " types: TypeSwitch, unsupported type", iterations, [&]
+            {
+                DoNotOptimize(missing);
+                TypeSwitch<List>::Apply(*missing, Accumulate{ &sum });
+            });
+
+        DoNotOptimize(sum);
+    }
+}
+
+namespace
+{
+    struct AccumulateTuple
+    {
+        size_t* sum;
+
+        template <typename... T>
+        auto operator()() const noexcept -> void
+        {
+            *sum += (T::value + ...);
+        }
+    };
+
+    template <size_t... N>
+    auto MeasureTupleArity() -> void
+    {
+        constexpr size_t iterations = 5'000'000;
+
+        using Tuples = typename Detail::Product<TypeList<>, TagList<N>...>::Type;
+
+        const std::type_info* last[] = { &typeid(DispatchTag<N - 1>)... };
+        size_t sum = 0;
+        std::string label;
+
+        ((label.append(label.empty() ? "" : "x").append(std::to_string(N))), ...);
+
+        Measure(label + " combined-key table, last tuple", iterations, [&]
+            {
+                DoNotOptimize(last);
+                TypeTupleSwitch<Tuples>::Apply(last, AccumulateTuple{ &sum });
+            });
+
+        DoNotOptimize(sum);
+    }
+}
+
+REFLECT_META_BENCH(TemplatedDispatch)
+{
+    MeasureListLength<1>();
+    MeasureListLength<4>();
+    MeasureListLength<16>();
+    MeasureListLength<32>();
+
+    MeasureTupleArity<8, 8>();
+    MeasureTupleArity<8, 8, 8>();
+}
+
+#pragma endregion
@@ -62,6 +62,13 @@ public:
         return T();
     }
 
+    template <typename From, typename To>
+        requires (sizeof(To) >= sizeof(From))
+    To Convert(const From& value) const noexcept
+    {
+        return static_cast<To>(value);
+    }
+
     const int& SomeCoolFunction() override
     {
         std::println("MyBaseClass::SomeCoolFunction");
@@ -81,4 +88,83 @@ public:
 
 };
 
+class Bar
+{
+public:
+    int width;
+    int height;
+
+    Bar() : width(0), height(0) { }
+
+    Bar(int width, int height) : width(width), height(height) { }
+
+    int Area() const noexcept
+    {
+        return width * height;
+    }
+
+    void Resize(int newWidth, int newHeight)
+    {
+        width = newWidth;
+        height = newHeight;
+    }
+};
+
+class Node
+{
+public:
+    int id = 0;
+
+    virtual ~Node() = default;
+
+    virtual int Weight() const
+    {
+        return id;
+    }
+
+    virtual int Depth() const
+    {
+        return 0;
+    }
+};
+
+class Labeled : public virtual Node
+{
+public:
+    int label = 0;
+
+    int Depth() const override
+    {
+        return 1;
+    }
+};
+
+class Panel final : public Bar, public Labeled
+{
+public:
+    int width = 0;
+};
+
+class Tagged : public virtual Node
+{
+public:
+    int tag = 0;
+};
+
+class Handle
+{
+public:
+    int id = 0;
+};
+
+class Widget final : public Labeled, public Tagged, public Handle
+{
+};
+
+class Plate final : public Handle, public Bar
+{
+public:
+    int layer = 0;
+};
+
 #pragma endregion
\ No newline at end of file
@@ -8,93 +8,187 @@ namespace ReflectMeta
     template <>
     struct Reflect<::MyBaseClass<int>>
     {
-        auto Get() const noexcept -> const TypeHierarchy&
+        auto Get() const -> TypeDesc
         {
-            auto& th = TypeHierarchy::New();
-
-            th.Struct<::MyBaseClass<int>>("::MyBaseClass<int>")
+            return TypeHierarchy::New()
+                .Struct<::MyBaseClass<int>>("::MyBaseClass<int>")
 				.Ctor<Access::PUBLIC, false, ::MyBaseClass<int>>()
                 .Member<Access::PUBLIC, int>("::MyBaseClass<int>::myTemplate", offsetof(::MyBaseClass<int>, myTemplate))
-                .Method<Access::PUBLIC, Qualifiers::NONE, const int&, ::MyBaseClass<int>>("::MyBaseClass<int>::SomeCoolFunction", &::MyBaseClass<int>::SomeCoolFunction, true)
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::MyBaseClass<int>::SomeCoolFunction>("::MyBaseClass<int>::SomeCoolFunction", true)
                 .MethodPureVirtual<Access::PUBLIC, Qualifiers::NONE, void, ::MyBaseClass<int>, int*>("::MyBaseClass<int>::SomeCoolerFunction")
                 .Commit();
-
-            return th;
         }
     };
 
     template <>
     struct Reflect<::MyOtherBaseClass>
     {
-        auto Get() const noexcept -> const TypeHierarchy&
+        auto Get() const -> TypeDesc
         {
-            auto& th = TypeHierarchy::New();
-
-            th.Struct<::MyOtherBaseClass>("::MyOtherBaseClass")
+            return TypeHierarchy::New()
+                .Struct<::MyOtherBaseClass>("::MyOtherBaseClass")
                 .Ctor<Access::PUBLIC, false, ::MyOtherBaseClass>()
                 .MethodPureVirtual<Access::PUBLIC, Qualifiers::NONE, void, ::MyOtherBaseClass>("::MyOtherBaseClass::MyCoolerMethod")
                 .Commit();
-
-            return th;
         }
     };
 
     template <>
     struct Reflect<::Foo>
     {
-        auto Get() const noexcept -> const TypeHierarchy&
+        auto Get() const -> TypeDesc
         {
-            auto& th = TypeHierarchy::New();
-
-            th.Struct<::Foo>("::Foo")
+            return TypeHierarchy::New()
+                .Struct<::Foo>("::Foo")
                 .Ctor<Access::PUBLIC, false, ::Foo>()
-                .Base<Access::PUBLIC, ::Foo, ::MyBaseClass<int>>("::MyBaseClass<int>", false)
-                .Base<Access::PUBLIC, ::Foo, ::MyOtherBaseClass>("::MyOtherBaseClass", false)
+                .Base<Access::PUBLIC, ::Foo, ::MyBaseClass<int>>("::MyBaseClass<int>")
+                .Base<Access::PUBLIC, ::Foo, ::MyOtherBaseClass>("::MyOtherBaseClass")
                 .Member<Access::PUBLIC, int>("::Foo::x", offsetof(::Foo, x))
                 .Member<Access::PUBLIC, float>("::Foo::y", offsetof(::Foo, y))
-                .Method<Access::PUBLIC, Qualifiers::CONST_, void, ::Foo, float*, std::string&>("::Foo::SomeMethod", &::Foo::SomeMethod)
-                .Method<Access::PUBLIC, Qualifiers::NONE, const int&, ::Foo>("::Foo::SomeCoolFunction", &::Foo::SomeCoolFunction, true)
-                .Method<Access::PUBLIC, Qualifiers::NONE, void, ::Foo, int*>("::Foo::SomeCoolerFunction", &::Foo::SomeCoolerFunction, true)
-                .Method<Access::PUBLIC, Qualifiers::NONE, void, ::Foo>("::Foo::MyCoolerMethod", &::Foo::MyCoolerMethod, true)
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::Foo::SomeMethod>("::Foo::SomeMethod")
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::Foo::SomeCoolFunction>("::Foo::SomeCoolFunction", true)
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::Foo::SomeCoolerFunction>("::Foo::SomeCoolerFunction", true)
+                .Method<Access::PUBLIC, Qualifiers::NONE, &::Foo::MyCoolerMethod>("::Foo::MyCoolerMethod", true)
                 .MethodTemplated<TypenameType::DEFAULT, TypenameClass, Access::PUBLIC, Qualifiers::NOEXCEPT_, void, ::Foo, TypenameClass*, TypenameClass&, const TypenameClass>("::Foo::SomeOtherMethod")
                 .MethodTemplated<TypenameType::CONCEPT, ConceptTypesInternal::MyConcept<TypenameClass>, Access::PUBLIC, Qualifiers::CONST_ | Qualifiers::NOEXCEPT_, ConceptTypesInternal::MyConcept<TypenameClass>, ::Foo, ConceptTypesInternal::MyConcept<TypenameClass>*, const ConceptTypesInternal::MyConcept<TypenameClass>&, ConceptTypesInternal::MyConcept<TypenameClass>**>("::Foo::SomeOtherOtherMethod")
+                .MethodTemplated<TypenameType::DEFAULT, TypenameClass, Access::PUBLIC, Qualifiers::CONST_ | Qualifiers::NOEXCEPT_, TypenameClass, ::Foo, const TypenameClass&>("::Foo::Convert", nullptr, 2)
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::Node>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Node>("::Node")
+                .Member<Access::PUBLIC, int>("::Node::id", Detail::MemberOffsetOf(&::Node::id))
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::Node::Weight>("::Node::Weight", true)
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::Node::Depth>("::Node::Depth", true)
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::Labeled>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Labeled>("::Labeled")
+                .Base<Access::PUBLIC, ::Labeled, ::Node, true>("::Node")
+                .Member<Access::PUBLIC, int>("::Labeled::label", Detail::MemberOffsetOf(&::Labeled::label))
+                .Method<Access::PUBLIC, Qualifiers::CONST_, &::Labeled::Depth>("::Labeled::Depth", true)
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::Panel>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Panel>("::Panel")
+                .Base<Access::PUBLIC, ::Panel, ::Bar>("::Bar")
+                .Base<Access::PUBLIC, ::Panel, ::Labeled>("::Labeled")
+                .Member<Access::PUBLIC, int>("::Panel::width", Detail::MemberOffsetOf(&::Panel::width))
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::Tagged>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Tagged>("::Tagged")
+                .Base<Access::PUBLIC, ::Tagged, ::Node, true>("::Node")
+                .Member<Access::PUBLIC, int>("::Tagged::tag", Detail::MemberOffsetOf(&::Tagged::tag))
+                .Commit();
+        }
+    };
+
+    template <>
+    struct Reflect<::Handle>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Handle>("::Handle")
+                .Member<Access::PUBLIC, int>("::Handle::id", offsetof(::Handle, id))
                 .Commit();
+        }
+    };
 
-            return th;
+    template <>
+    struct Reflect<::Widget>
+    {
+        auto Get() const -> TypeDesc
+        {
+            return TypeHierarchy::New()
+                .Struct<::Widget>("::Widget")
+                .Base<Access::PUBLIC, ::Widget, ::Labeled>("::Labeled")
+                .Base<Access::PUBLIC, ::Widget, ::Tagged>("::Tagged")
+                .Base<Access::PUBLIC, ::Widget, ::Handle>("::Handle")
+                .Commit();
         }
     };
 
     template <>
     struct Reflect_Impl<::MyBaseClass<int>>
     {
-        inline static bool done = []
-            {
-                auto& th = Reflect<::MyBaseClass<int>>{}.Get();
-                const TypeDesc* td = th.Get("::MyBaseClass<int>"); static TypeDesc single = *td;
-                static bool once = (Registry::Instance().RegisterRange(&single, &single + 1), Registry::Instance().MapStdTypeIndex(std::type_index(typeid(::MyBaseClass<int>)), single.id), true); (void)once; return true;
-            }();
+        inline static bool done = RegisterReflected<::MyBaseClass<int>>("::MyBaseClass<int>");
     };
 
     template <> 
     struct Reflect_Impl<::MyOtherBaseClass>
     {
-        inline static bool done = []
-            {
-                auto& th = Reflect<::MyOtherBaseClass>{}.Get();
-                const TypeDesc* td = th.Get("::MyOtherBaseClass"); static TypeDesc single = *td;
-                static bool once = (Registry::Instance().RegisterRange(&single, &single + 1), Registry::Instance().MapStdTypeIndex(std::type_index(typeid(::MyOtherBaseClass)), single.id), true); (void)once; return true;
-            }();
+        inline static bool done = RegisterReflected<::MyOtherBaseClass>("::MyOtherBaseClass");
     };
 
     template <>
     struct Reflect_Impl<::Foo>
     {
-        inline static bool done = []
-            {
-                auto& th = Reflect<::Foo>{}.Get();
-                const TypeDesc* td = th.Get("::Foo"); static TypeDesc single = *td;
-                static bool once = (Registry::Instance().RegisterRange(&single, &single + 1), Registry::Instance().MapStdTypeIndex(std::type_index(typeid(::Foo)), single.id), true); (void)once; return true;
-            }();
+        inline static bool done = RegisterReflected<::Foo>("::Foo");
+    };
+
+    template <>
+    struct Reflect_Impl<::Node>
+    {
+        inline static bool done = RegisterReflected<::Node>("::Node");
+    };
+
+    template <>
+    struct Reflect_Impl<::Labeled>
+    {
+        inline static bool done = RegisterReflected<::Labeled>("::Labeled");
+    };
+
+    template <>
+    struct Reflect_Impl<::Panel>
+    {
+        inline static bool done = RegisterReflected<::Panel>("::Panel");
+    };
+
+    template <>
+    struct Reflect_Impl<::Tagged>
+    {
+        inline static bool done = RegisterReflected<::Tagged>("::Tagged");
+    };
+
+    template <>
+    struct Reflect_Impl<::Handle>
+    {
+        inline static bool done = RegisterReflected<::Handle>("::Handle");
+    };
+
+    template <>
+    struct Reflect_Impl<::Widget>
+    {
+        inline static bool done = RegisterReflected<::Widget>("::Widget");
     };
 }
 
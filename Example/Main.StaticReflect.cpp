@@ -0,0 +1,67 @@
+#pragma region Main.StaticReflect.cpp
+
+#include <iterator>
+#include "ReflectMeta/ReflectMeta.hpp"
+#include "Foo.hpp"
+
+namespace ReflectMeta
+{
+    template <>
+    struct Reflect<::Bar>
+    {
+        using Th = StaticTypeHierarchy<::Bar>;
+
+        static constexpr FieldDesc fields[] =
+        {
+            Th::Member<Access::PUBLIC, int>("::Bar::width", offsetof(::Bar, width)),
+            Th::Member<Access::PUBLIC, int>("::Bar::height", offsetof(::Bar, height))
+        };
+
+        static constexpr MethodDesc methods[] =
+        {
+            Th::Method<Access::PUBLIC, Qualifiers::CONST_ | Qualifiers::NOEXCEPT_, &::Bar::Area>("::Bar::Area"),
+            Th::Method<Access::PUBLIC, Qualifiers::NONE, &::Bar::Resize>("::Bar::Resize")
+        };
+
+        static constexpr CtorDesc constructors[] =
+        {
+            Th::Ctor<Access::PUBLIC, false>("::Bar"),
+            Th::Ctor<Access::PUBLIC, false, int, int>("::Bar")
+        };
+
+        static constexpr TypeDesc Get()
+        {
+            return Th::Struct("::Bar", { .fields = fields, .methods = methods, .templatedMethods = {}, .bases = {}, .constructors = constructors, .destructor = Th::Dtor<Access::PUBLIC>("::Bar"), .isPooled = true, .isTriviallyRelocatable = false });
+        }
+    };
+
+    template <>
+    struct Reflect<::Plate>
+    {
+        using Th = StaticTypeHierarchy<::Plate>;
+
+        static constexpr BaseDesc bases[] =
+        {
+            Th::Base<Access::PUBLIC, ::Handle>("::Handle"),
+            Th::Base<Access::PUBLIC, ::Bar>("::Bar")
+        };
+
+        static constexpr TypeDesc Get()
+        {
+            return Th::Struct("::Plate", { .fields = {}, .methods = {}, .templatedMethods = {}, .bases = bases, .constructors = {}, .destructor = Th::Dtor<Access::PUBLIC>("::Plate"), .isPooled = false, .isTriviallyRelocatable = false });
+        }
+    };
+}
+
+namespace
+{
+    constinit ReflectMeta::TypeDesc gStaticModuleTypes[] =
+    {
+        ReflectMeta::Reflect<::Bar>::Get(),
+        ReflectMeta::Reflect<::Plate>::Get()
+    };
+
+    const bool gStaticModuleRegistered = ReflectMeta::Registry::Instance().RegisterRange(std::begin(gStaticModuleTypes), std::end(gStaticModuleTypes));
+}
+
+#pragma endregion
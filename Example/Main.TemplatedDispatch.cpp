@@ -26,6 +26,16 @@ namespace ReflectMetaGenerated
                 return self.template SomeOtherOtherMethod<T>(pointerValue, referenceValue, pointerToPointer);
             }
         };
+
+        struct BinderConvert
+        {
+            template <typename From, typename To>
+                requires (sizeof(To) >= sizeof(From))
+            static auto Call(::Foo& self, const From& value) noexcept -> To
+            {
+                return self.template Convert<From, To>(value);
+            }
+        };
     };
 }
 
@@ -52,10 +62,41 @@ static constexpr auto kSomeOtherOtherMethodErased =
     ReflectMetaGenerated::FooBinders::BinderSomeOtherOtherMethod,
     ReflectMeta::Meta::ParamPtr, ReflectMeta::Meta::ParamCLRef, ReflectMeta::Meta::ParamPtrPtr>;
 
+static constexpr auto kSomeOtherMethodSpecializations =
+ReflectMeta::GenericTemplatedSpecializations<
+    ReflectMeta::DefaultTemplateTag, ::Foo,
+    ReflectMeta::Meta::RetVoid,
+    ReflectMetaGenerated::FooBinders::BinderSomeOtherMethod,
+    ReflectMeta::Meta::ParamPtr, ReflectMeta::Meta::ParamLRef, ReflectMeta::Meta::ParamCVal>();
+
+static constexpr auto kSomeOtherOtherMethodSpecializations =
+ReflectMeta::GenericTemplatedSpecializations<
+    ReflectMeta::ConceptTypesInternal::MyConcept_Tag, ::Foo,
+    ReflectMeta::Meta::RetSelf,
+    ReflectMetaGenerated::FooBinders::BinderSomeOtherOtherMethod,
+    ReflectMeta::Meta::ParamPtr, ReflectMeta::Meta::ParamCLRef, ReflectMeta::Meta::ParamPtrPtr>();
+
+using ConvertTags = ReflectMeta::TypeList<ReflectMeta::DefaultTemplateTag, ReflectMeta::DefaultTemplateTag>;
+
+static constexpr auto kConvertErased =
+&ReflectMeta::GenericMultiTemplatedErasedCaller<
+    ConvertTags, ::Foo,
+    ReflectMeta::Meta::On<1, ReflectMeta::Meta::RetSelf>::Expr,
+    ReflectMetaGenerated::FooBinders::BinderConvert,
+    ReflectMeta::Meta::On<0, ReflectMeta::Meta::ParamCLRef>::Expr>;
+
+static constexpr auto kConvertSpecializations =
+ReflectMeta::GenericMultiTemplatedSpecializations<
+    ConvertTags, ::Foo,
+    ReflectMeta::Meta::On<1, ReflectMeta::Meta::RetSelf>::Expr,
+    ReflectMetaGenerated::FooBinders::BinderConvert,
+    ReflectMeta::Meta::On<0, ReflectMeta::Meta::ParamCLRef>::Expr>();
+
 inline static bool gWireTemplatedDispatch = []
     {
-        Registry::Instance().AttachTemplatedDispatcher("::Foo", "SomeOtherMethod", kSomeOtherMethodErased, nullptr);
-        Registry::Instance().AttachTemplatedDispatcher("::Foo", "SomeOtherOtherMethod", kSomeOtherOtherMethodErased, nullptr);
+        Registry::Instance().AttachTemplatedDispatcher("::Foo", "SomeOtherMethod", kSomeOtherMethodErased, nullptr, kSomeOtherMethodSpecializations);
+        Registry::Instance().AttachTemplatedDispatcher("::Foo", "SomeOtherOtherMethod", kSomeOtherOtherMethodErased, nullptr, kSomeOtherOtherMethodSpecializations);
+        Registry::Instance().AttachTemplatedDispatcher("::Foo", "Convert", kConvertErased, nullptr, kConvertSpecializations);
 
         return true;
     }();
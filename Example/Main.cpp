@@ -1,4 +1,4 @@
-#pragma region Main.cpp
+﻿#pragma region Main.cpp
 
 #include <iostream>
 #include "Foo.hpp"
@@ -50,6 +50,38 @@ int main()
     Expect(baseTDesc != nullptr, "::MyBaseClass<int> not registered");
     Expect(ifaceDesc != nullptr, "::MyOtherBaseClass not registered");
 
+    Expect(Registry::Instance().Get<::Foo>() == fooDesc, "Get<Foo>() mismatch");
+    Expect(Registry::Instance().Get<const ::MyOtherBaseClass>() == ifaceDesc, "Get<const MyOtherBaseClass>() mismatch");
+
+    Expect(Registry::Instance().Get("Foo") == fooDesc, "Simple-name lookup of Foo mismatch");
+    Expect(Registry::Instance().GetAllBySimpleName("MyOtherBaseClass").size() == 1, "GetAllBySimpleName(MyOtherBaseClass) should have one hit");
+    Expect(Registry::Instance().Get("NoSuchType") == nullptr, "Unknown simple name should not resolve");
+
+    {
+        constexpr TypeId fooId = TypeIdOf("::Foo");
+        static_assert(fooId.hi != fooId.lo && fooId != TypeIdOf("::Fop"), "TypeId halves should be independent");
+
+        Expect(fooDesc->id == fooId, "::Foo id should match the compile-time TypeIdOf");
+
+        TypeDesc impostor = TypeHierarchy::New().Struct<::Bar>("::Impostor").Commit();
+        impostor.id = fooId;
+
+        Expect(Registry::Instance().Register(std::move(impostor)) == nullptr, "A different name registered under ::Foo's id should be rejected");
+        Expect(Registry::Instance().Get("::Foo") == fooDesc, "An id collision should not shadow ::Foo");
+
+        const auto collisions = Registry::Instance().IdCollisions();
+        Expect(collisions.size() == 1 && collisions[0].first == "::Foo" && collisions[0].second == "::Impostor", "The ::Foo id collision should be recorded");
+
+        Registry::Instance().RegisterLazy("::LazyTarget", nullptr, +[]() -> TypeDesc { return TypeHierarchy::New().Struct<::Bar>("::LazyTarget").Commit(); });
+
+        TypeDesc lazyImpostor = TypeHierarchy::New().Struct<::Bar>("::LazyImpostor").Commit();
+        lazyImpostor.id = TypeIdOf("::LazyTarget");
+        const size_t adopted = Registry::Instance().AdoptedDescriptors();
+
+        Expect(Registry::Instance().Register(std::move(lazyImpostor)) == nullptr, "A different name registered under a lazy type's id should be rejected");
+        Expect(Registry::Instance().AdoptedDescriptors() == adopted, "A rejected descriptor should not be kept");
+    }
+
     Expect(fooDesc->isPolymorphic, "::Foo should be polymorphic");
     Expect(fooDesc->bases.size() == 2, "::Foo should have exactly two direct bases");
 
@@ -58,6 +90,42 @@ int main()
     Expect(base1 != nullptr, "Missing base ::MyBaseClass<int>");
     Expect(base2 != nullptr, "Missing base ::MyOtherBaseClass");
 
+    {
+        Foo castFoo{};
+        const std::ptrdiff_t otherOffset = reinterpret_cast<std::byte*>(static_cast<MyOtherBaseClass*>(&castFoo)) - reinterpret_cast<std::byte*>(&castFoo);
+
+        Expect(base2->offsetInBytes == static_cast<size_t>(otherOffset) && otherOffset != 0, "::Foo -> ::MyOtherBaseClass offset mismatch");
+        Expect(Registry::Instance().CastTo(&castFoo, *fooDesc, *ifaceDesc) == static_cast<MyOtherBaseClass*>(&castFoo), "CastTo ::MyOtherBaseClass mismatch");
+        Expect(Registry::Instance().CastTo(&castFoo, *fooDesc, *baseTDesc) == static_cast<MyBaseClass<int>*>(&castFoo), "CastTo ::MyBaseClass<int> mismatch");
+        Expect(Registry::Instance().CastTo(static_cast<MyOtherBaseClass*>(&castFoo), *ifaceDesc, *fooDesc) == nullptr, "CastTo should not downcast");
+
+        const TypeDesc* panelDesc = Registry::Instance().Get<::Panel>();
+        const TypeDesc* nodeDesc = Registry::Instance().Get<::Node>();
+        Panel panel;
+
+        Expect(panelDesc != nullptr && nodeDesc != nullptr && Registry::Instance().Ancestors(*panelDesc).entries.size() == 3, "::Panel ancestor table mismatch");
+        Expect(Registry::Instance().CastTo(&panel, *panelDesc, *Registry::Instance().Get<::Labeled>()) == static_cast<Labeled*>(&panel), "CastTo ::Labeled mismatch");
+        Expect(Registry::Instance().CastTo(&panel, *panelDesc, *nodeDesc) == static_cast<Node*>(&panel), "CastTo through a virtual base mismatch");
+        Expect(Registry::Instance().CastTo(&panel, *panelDesc, *Registry::Instance().Get<::Bar>()) == static_cast<Bar*>(&panel), "CastTo ::Bar mismatch");
+        Expect(Registry::Instance().CastTo(&panel, *panelDesc, *fooDesc) == nullptr && Registry::Instance().CastTo(&panel, *panelDesc, *ifaceDesc) == nullptr, "CastTo to an unrelated type should miss");
+
+        Expect(Registry::Instance().IsA(*fooDesc, *baseTDesc) && Registry::Instance().IsA(*fooDesc, *ifaceDesc), "::Foo should be both of its bases");
+        Expect(Registry::Instance().IsA(*fooDesc, *fooDesc), "IsA should be reflexive");
+        Expect(!Registry::Instance().IsA(*ifaceDesc, *fooDesc) && !Registry::Instance().IsA(*baseTDesc, *ifaceDesc), "IsA should not hold for unrelated or derived types");
+        Expect(Registry::Instance().IsA(*panelDesc, *nodeDesc) && Registry::Instance().IsA("::Panel", "::Bar"), "::Panel should be a ::Node and a ::Bar");
+        Expect(!Registry::Instance().IsA(*nodeDesc, *panelDesc) && !Registry::Instance().IsA(*panelDesc, *fooDesc), "::Node should not be a ::Panel");
+
+        const TypeDesc* latePanel = Registry::Instance().Register(TypeHierarchy::New().Struct<::Panel>("::LatePanel").Base<Access::PUBLIC, ::Panel, ::Labeled>("::LateLabeled").Commit());
+        const AncestorTable* fooAncestors = &Registry::Instance().Ancestors(*fooDesc);
+
+        Expect(latePanel != nullptr && Registry::Instance().Ancestors(*latePanel).entries.size() == 1, "::LatePanel should only know its unregistered base");
+
+        Registry::Instance().Register(TypeHierarchy::New().Struct<::Labeled>("::LateLabeled").Base<Access::PUBLIC, ::Labeled, ::Node, true>("::Node").Commit());
+
+        Expect(Registry::Instance().Ancestors(*latePanel).entries.size() == 2 && Registry::Instance().IsA(*latePanel, *nodeDesc), "Registering a base should rebuild its descendants' tables");
+        Expect(&Registry::Instance().Ancestors(*fooDesc) == fooAncestors, "Registering a type should keep unrelated hierarchy tables");
+    }
+
     {
         const MethodDesc* pv = FindMethod(baseTDesc, "SomeCoolerFunction");
 
@@ -74,6 +142,14 @@ int main()
         Expect(ifacePure->isVirtual && ifacePure->isPureVirtual, "MyCoolerMethod should be pure virtual");
     }
 
+    {
+        Expect(fooDesc->nameIndex.built, "::Foo name index should be built on registration");
+        Expect(ReflectMeta::FindField(*fooDesc, true, "::Foo::y") == &fooDesc->fields[1], "Qualified field lookup mismatch");
+        Expect(ReflectMeta::FindField(*fooDesc, true, "y") == &fooDesc->fields[1], "Simple field lookup mismatch");
+        Expect(ReflectMeta::FindMethod(*fooDesc, true, "::Foo::SomeMethod") == ReflectMeta::FindMethod(*fooDesc, true, "SomeMethod"), "Qualified/simple method lookup mismatch");
+        Expect(ReflectMeta::FindField(*fooDesc, true, "missing") == nullptr, "Unknown field should not resolve");
+    }
+
     Foo foo{};
     ClassTypeErased fooClass{ fooDesc };
 
@@ -108,6 +184,50 @@ int main()
     
     Registry::Instance().Delete("::Foo", foo1);
 
+    {
+        alignas(::Foo) std::byte fooArray[sizeof(::Foo) * 3];
+
+        Expect(fooType1.ConstructArray(fooArray, 3, fooType1.GetCtor(0, nullptr), nullptr), "::Foo ConstructArray failed");
+
+        ::Foo* foos = std::launder(reinterpret_cast<::Foo*>(fooArray));
+
+        Expect(foos[2].x == 0 && foos[2].y == 0.0f && &foos[2].SomeCoolFunction() == &foos[2].x, "::Foo ConstructArray should value-initialize every element");
+        Expect(!fooType1.DestroyArray(foos, 3), "::Foo has no registered destructor, DestroyArray should fail");
+
+        std::destroy_n(foos, 3);
+    }
+
+    {
+        Expect(!fooDesc->isTriviallyCopyable && fooDesc->isTriviallyDestructible && !fooDesc->isTriviallyRelocatable, "::Foo trait flags mismatch");
+
+        alignas(::Foo) std::byte cloneStorage[sizeof(::Foo)];
+
+        Expect(fooClass.CopyConstruct(cloneStorage, &foo), "::Foo CopyConstruct failed");
+
+        ::Foo* clone = std::launder(reinterpret_cast<::Foo*>(cloneStorage));
+
+        Expect(clone->x == foo.x && &clone->SomeCoolFunction() == &clone->x, "::Foo CopyConstruct should copy members and the vtable");
+
+        clone->x = 7;
+
+        Expect(fooClass.CopyAssign(&foo, clone) && foo.x == 7, "::Foo CopyAssign mismatch");
+        Expect(!ClassTypeErased{ baseTDesc }.CopyConstruct(cloneStorage, &foo), "Abstract ::MyBaseClass<int> should not be copy constructible");
+
+        clone->~Foo();
+    }
+
+    {
+        ClassType<::Foo> fooTyped{ fooDesc };
+        const int& xRef = fooTyped.GetMethodCT<"SomeCoolFunction", const int&>().Invoke(foo);
+
+        Expect(&xRef == &foo.x, "Typed SomeCoolFunction should return a reference to ::Foo::x");
+
+        const int* xAddress = nullptr;
+        fooClass.GetMethod(true, "SomeCoolFunction").InvokeInto(&foo, nullptr, &xAddress);
+
+        Expect(xAddress == &foo.x, "InvokeInto of a reference return should yield the address of ::Foo::x");
+    }
+
     {
         auto m = fooClass.GetMethod(true, "SomeCoolerFunction");
         int localValue = 123;
@@ -161,6 +281,57 @@ int main()
         Expect(returnValue == 0.0f, "SomeOtherOtherMethod<float> return mismatch");
     }
 
+    {
+        const std::type_info* targsFloat[] = { &typeid(float) };
+        auto specialized = fooClass.GetMethodTemplated(false, "SomeOtherOtherMethod").Specialize(targsFloat);
+
+        Expect(!!specialized, "Specialize<float> failed for SomeOtherOtherMethod");
+
+        float r = 2.0f;
+        float* pointerIn = &r;
+        float** pointerPointer = nullptr;
+        float returnValue = -1.0f;
+        void* args[] = { &pointerIn, &r, &pointerPointer };
+
+        specialized->Invoke(&foo, args, &returnValue);
+
+        Expect(returnValue == 0.0f, "Specialized SomeOtherOtherMethod<float> return mismatch");
+
+        const std::type_info* targsBad[] = { &typeid(std::string) };
+
+        Expect(!fooClass.GetMethodTemplated(false, "SomeOtherOtherMethod").Specialize(targsBad), "Specialize should reject unsupported types");
+    }
+
+    {
+        auto convert = fooClass.GetMethodTemplated(false, "Convert");
+        const std::type_info* intToDouble[] = { &typeid(int), &typeid(double) };
+        const std::type_info* doubleToInt[] = { &typeid(double), &typeid(int) };
+        const std::type_info* floatToDouble[] = { &typeid(float), &typeid(double) };
+
+        int intValue = 7;
+        double doubleResult = 0.0;
+        void* intArgs[] = { &intValue };
+        convert.InvokeWithType(intToDouble, &foo, intArgs, &doubleResult);
+
+        Expect(doubleResult == 7.0, "Convert<int, double> mismatch");
+
+        double doubleValue = 3.0;
+        int intResult = -1;
+        void* doubleArgs[] = { &doubleValue };
+        convert.InvokeWithType(doubleToInt, &foo, doubleArgs, &intResult);
+
+        Expect(intResult == -1, "Convert<double, int> should be pruned by the binder constraint");
+        Expect(!convert.Specialize(doubleToInt), "Specialize<double, int> should be pruned");
+
+        auto floatToDoubleCall = convert.Specialize(floatToDouble);
+        float floatValue = 1.5f;
+        void* floatArgs[] = { &floatValue };
+        floatToDoubleCall->Invoke(&foo, floatArgs, &doubleResult);
+
+        Expect(doubleResult == 1.5, "Specialized Convert<float, double> mismatch");
+        Expect(ReflectMeta::FindTemplatedMethod(*fooDesc, false, "Convert")->templateArity == 2, "Convert should report two template parameters");
+    }
+
     {
         ::MyBaseClass<int>* basePtr = static_cast<::MyBaseClass<int>*>(&foo);
         ClassTypeErased baseClass{ baseTDesc };
@@ -172,6 +343,103 @@ int main()
         myTemplateErased.GetAny(basePtr, &baseRead);
 
         Expect(baseRead == 1234, "MyBaseClass<int>::myTemplate assign/get mismatch");
+
+        int inheritedRead = 0;
+        fooClass.GetMember(true, "myTemplate").GetAny(&foo, &inheritedRead);
+
+        Expect(inheritedRead == 1234, "Inherited ::Foo::myTemplate mismatch");
+    }
+
+    {
+        ClassTypeErased panelClass{ Registry::Instance().Get<::Panel>() };
+        Panel panel;
+        panel.Resize(3, 4);
+        panel.width = 9;
+        panel.label = 5;
+        panel.id = 11;
+
+        int read = 0;
+        panelClass.GetMember(true, "width").GetAny(&panel, &read);
+        Expect(read == 9, "::Panel::width should hide ::Bar::width");
+
+        panelClass.GetMember(true, "height").GetAny(&panel, &read);
+        Expect(read == 4, "Inherited ::Bar::height mismatch");
+
+        panelClass.GetMember(true, "label").GetAny(&panel, &read);
+        Expect(read == 5, "Inherited ::Labeled::label mismatch");
+
+        const int newId = 42;
+        panelClass.GetMember(true, "id").AssignAny(&panel, &newId);
+        Expect(panel.id == 42, "Inherited ::Node::id through a virtual base mismatch");
+        Expect(!panelClass.GetMember(true, "id").AsTyped<int>().has_value(), "A member behind a virtual base has no fixed offset");
+
+        int area = 0;
+        panelClass.GetMethod(true, "Area").Invoke(&panel, nullptr, &area);
+        Expect(area == 12, "Inherited ::Bar::Area mismatch");
+
+        const InheritedView& view = Registry::Instance().Inherited(*panelClass.GetDesc());
+        Expect(view.fields.size() == 4 && FindInheritedField(view, true, "::Bar::width") == nullptr, "::Panel inherited view should apply name hiding");
+
+        const InheritedView& widgetView = Registry::Instance().Inherited(*Registry::Instance().Get<::Widget>());
+        const InheritedField* nodeId = FindInheritedField(widgetView, true, "::Node::id");
+        const InheritedField* handleId = FindInheritedField(widgetView, true, "::Handle::id");
+
+        Expect(FindInheritedField(widgetView, true, "id") == nullptr, "::Widget::id should be ambiguous between ::Node and ::Handle");
+        Expect(nodeId != nullptr && handleId != nullptr && nodeId->isAmbiguous && handleId->isAmbiguous, "Ambiguous ::Widget members should be marked");
+        Expect(widgetView.fields.size() == 4, "::Node::id reached through two virtual paths should appear once");
+        Expect(FindInheritedField(widgetView, true, "tag") != nullptr && FindInheritedField(widgetView, true, "label") != nullptr, "Unique ::Widget members should resolve by simple name");
+
+        const InheritedMethod* depth = FindInheritedMethod(widgetView, true, "Depth");
+
+        Expect(depth != nullptr && !depth->isAmbiguous && depth->method->qualifiedName == "::Labeled::Depth", "::Labeled::Depth should dominate the virtual ::Node::Depth");
+        Expect(FindInheritedMethod(widgetView, true, "Weight") != nullptr, "::Node::Weight through a shared virtual base is not ambiguous");
+    }
+
+    {
+        Registry& registry = Registry::Instance();
+
+        const VirtualSlot coolSlot = registry.SlotOf(*baseTDesc, "SomeCoolFunction");
+        const VirtualSlot coolerSlot = registry.SlotOf(*baseTDesc, "SomeCoolerFunction");
+        const VirtualSlot coolerMethodSlot = registry.SlotOf(*ifaceDesc, "MyCoolerMethod");
+
+        Expect(coolSlot == VirtualSlot{ baseTDesc->id, 0 } && coolerSlot == VirtualSlot{ baseTDesc->id, 1 }, "::MyBaseClass<int> slots should be numbered in declaration order");
+        Expect(coolerMethodSlot == VirtualSlot{ ifaceDesc->id, 0 }, "::MyOtherBaseClass slots should be numbered from its own root");
+        Expect(coolSlot == registry.SlotOf(*fooDesc, "SomeCoolFunction") && coolerMethodSlot == registry.SlotOf(*fooDesc, "MyCoolerMethod"), "::Foo should inherit its bases' slots");
+        Expect(registry.VirtualTableOf(*fooDesc).slots.size() == 3, "::Foo virtual table should be compact");
+        Expect(registry.VirtualTableOf(*fooDesc).slots[registry.VirtualTableOf(*fooDesc).IndexOf(coolSlot)].method == FindMethod(*fooDesc, true, "SomeCoolFunction"), "::Foo should override SomeCoolFunction");
+        Expect(registry.InvokeSlot(&foo, *fooDesc, coolerMethodSlot, nullptr, nullptr), "InvokeSlot ::Foo::MyCoolerMethod failed");
+        Expect(!registry.InvokeSlot(&foo, *fooDesc, VirtualSlot{}, nullptr, nullptr), "InvokeSlot should reject an unknown slot");
+        Expect(!registry.InvokeSlot(&foo, *fooDesc, VirtualSlot{ ifaceDesc->id, 1 }, nullptr, nullptr), "InvokeSlot should reject an out-of-range slot");
+        Expect(!registry.InvokeSlot(&foo, *ifaceDesc, coolerMethodSlot, nullptr, nullptr), "InvokeSlot should reject a pure virtual final overrider");
+
+        const TypeDesc* nodeDesc = registry.Get<::Node>();
+        const TypeDesc* panelDesc = registry.Get<::Panel>();
+        Panel panel;
+        panel.id = 17;
+
+        ClassTypeErased nodeClass{ nodeDesc };
+        ClassType<::Node> nodeTyped{ nodeDesc };
+        Node node;
+        node.id = 42;
+        int weight = 0;
+        int depth = -1;
+
+        nodeClass.GetMethod(true, "Weight").Invoke(&node, nullptr, &weight);
+        nodeClass.GetMethod(true, "Depth").Invoke(&node, nullptr, &depth);
+
+        Expect(weight == 42 && depth == 0, "Same-signature ::Node methods should call their own member functions");
+        Expect(nodeTyped.GetMethodCT<"Depth", int>().Invoke(node) == 0 && nodeTyped.GetMethodCT<"Weight", int>().Invoke(node) == 42, "Typed same-signature ::Node methods mismatch");
+
+        const VirtualSlot weightSlot = registry.SlotOf(*nodeDesc, "Weight");
+        const VirtualSlot depthSlot = registry.SlotOf(*nodeDesc, "Depth");
+        int result = 0;
+
+        Expect(weightSlot == VirtualSlot{ nodeDesc->id, 0 } && depthSlot == VirtualSlot{ nodeDesc->id, 1 }, "::Node slots should be numbered in declaration order");
+        Expect(registry.InvokeSlot(&node, *nodeDesc, weightSlot, nullptr, &result) && result == 42, "InvokeSlot ::Node::Weight mismatch");
+        Expect(registry.InvokeSlot(&node, *nodeDesc, depthSlot, nullptr, &result) && result == 0, "InvokeSlot ::Node::Depth mismatch");
+
+        Expect(registry.InvokeSlot(&panel, *panelDesc, weightSlot, nullptr, &result) && result == 17, "InvokeSlot through a virtual base mismatch");
+        Expect(registry.InvokeSlot(&panel, *panelDesc, depthSlot, nullptr, &result) && result == 1, "InvokeSlot should reach the ::Labeled override");
     }
 
     {
@@ -188,6 +456,164 @@ int main()
         Expect(returnValue == "untouched", "Concept gating failed: std::string call should be ignored");
     }
 
+    {
+        const TypeDesc* barDesc = Registry::Instance().Get<::Bar>();
+
+        Expect(barDesc != nullptr, "::Bar (static tables) not registered");
+        Expect(barDesc == Registry::Instance().Get("::Bar"), "::Bar lookup by name mismatch");
+        Expect(barDesc->fields.size() == 2 && barDesc->methods.size() == 2, "::Bar table sizes mismatch");
+
+        const TypeDesc* plateDesc = Registry::Instance().Get<::Plate>();
+        const BaseDesc* plateBar = plateDesc != nullptr ? FindBaseByName(plateDesc, "::Bar") : nullptr;
+        Plate plate;
+        const size_t barOffset = static_cast<size_t>(reinterpret_cast<std::byte*>(static_cast<Bar*>(&plate)) - reinterpret_cast<std::byte*>(&plate));
+
+        Expect(plateBar != nullptr && plateBar->offsetInBytes == barOffset && barOffset != 0, "::Plate -> ::Bar static base offset mismatch");
+        Expect(Registry::Instance().CastTo(&plate, *plateDesc, *barDesc) == static_cast<Bar*>(&plate), "CastTo ::Bar from static ::Plate mismatch");
+
+        int width = 3;
+        int height = 4;
+        void* ctorArgs[] = { &width, &height };
+        const std::type_info* ctorTypes[] = { &typeid(int), &typeid(int) };
+        void* bar = Registry::Instance().New("::Bar", ctorArgs, 2, ctorTypes);
+
+        Expect(bar != nullptr, "Failed to construct ::Bar(int, int)");
+
+        {
+            const CtorDesc* typed = FindCtor(*barDesc, true, 2, ctorTypes);
+            MethodParam nameOnly[] = { typed->parameters[0], typed->parameters[1] };
+
+            for (MethodParam& p : nameOnly)
+            {
+                p.type.qualifiedName = typeid(int).name();
+                p.type.typeInfo = nullptr;
+            }
+
+            CtorDesc ctor = *typed;
+            ctor.parameters = nameOnly;
+
+            TypeDesc nameOnlyBar = *barDesc;
+            nameOnlyBar.constructors = std::span<const CtorDesc>(&ctor, 1);
+            nameOnlyBar.nameIndex = {};
+            BuildNameIndex(nameOnlyBar);
+
+            const std::type_info* missTypes[] = { &typeid(int), &typeid(float) };
+
+            Expect(FindCtor(nameOnlyBar, true, 2, ctorTypes) == &ctor, "Name-only constructor parameters should be found through the signature index");
+            Expect(FindCtor(nameOnlyBar, true, 2, missTypes) == nullptr, "Signature index miss should be authoritative");
+        }
+
+        ClassTypeErased barClass{ barDesc };
+        int area = 0;
+        barClass.GetMethod(true, "Area").Invoke(bar, nullptr, &area);
+
+        Expect(area == 12, "::Bar::Area mismatch");
+
+        alignas(int) std::byte areaStorage[sizeof(int)];
+        barClass.GetMethod(true, "Area").InvokeInto(bar, nullptr, areaStorage);
+
+        Expect(*std::launder(reinterpret_cast<int*>(areaStorage)) == 12, "::Bar::Area InvokeInto mismatch");
+
+        int newWidth = 5;
+        int newHeight = 6;
+        void* resizeArgs[] = { &newWidth, &newHeight };
+        barClass.GetMethod(true, "Resize").Invoke(bar, resizeArgs, nullptr);
+
+        int readHeight = 0;
+        barClass.GetMember(true, "height").GetAny(bar, &readHeight);
+
+        Expect(readHeight == 6, "::Bar::height mismatch after Resize");
+
+        ClassType<::Bar> barTyped{ barDesc };
+        barTyped.GetMethodCT<"Resize", void, int, int>().Invoke(*static_cast<::Bar*>(bar), 7, 8);
+
+        Expect(barTyped.GetMethodCT<"Area", int>().Invoke(*static_cast<::Bar*>(bar)) == 56, "Typed ::Bar::Area mismatch");
+
+        const TypeDesc* barView = Registry::Instance().Register(TypeHierarchy::New().Struct<::Bar>("::BarView")
+            .Member<Access::PUBLIC, int>("::BarView::height", offsetof(::Bar, height))
+            .Method<Access::PUBLIC, Qualifiers::CONST_ | Qualifiers::NOEXCEPT_, &::Bar::Area>("::BarView::Area")
+            .Commit());
+        ClassType<::Bar> barViewTyped{ barView };
+
+        Expect(barTyped.GetMemberCT<"height">().GetQualifiedName() == "::Bar::height" && barViewTyped.GetMemberCT<"height">().GetQualifiedName() == "::BarView::height", "Cached member lookup should follow the wrapped descriptor");
+        Expect(barViewTyped.GetMethodCT<"Area", int>().GetQualifiedName() == "::BarView::Area" && barTyped.GetMethodCT<"Area", int>().GetQualifiedName() == "::Bar::Area", "Cached method lookup should follow the wrapped descriptor");
+
+        ::Bar bars[3] = { ::Bar(1, 2), ::Bar(3, 4), ::Bar(5, 6) };
+        int areas[3] = {};
+        barClass.GetMethod(true, "Area").InvokeBatch(bars, sizeof(::Bar), 3, nullptr, nullptr, areas, sizeof(int));
+
+        Expect(areas[0] == 2 && areas[1] == 12 && areas[2] == 30, "Batched ::Bar::Area mismatch");
+
+        int widths[3] = { 10, 20, 30 };
+        int sharedHeight = 2;
+        void* batchArgs[] = { widths, &sharedHeight };
+        const size_t batchStrides[] = { sizeof(int), 0 };
+        void* const barPointers[] = { &bars[2], &bars[0], &bars[1] };
+        barClass.GetMethod(true, "Resize").InvokeBatch(barPointers, batchArgs, batchStrides, nullptr, 0);
+
+        Expect(bars[2].width == 10 && bars[0].width == 20 && bars[1].width == 30 && bars[1].height == 2, "Batched ::Bar::Resize mismatch");
+        Expect(Registry::Instance().Delete("::Bar", bar), "Failed to delete ::Bar");
+
+        const CtorHandle barCtor = Registry::Instance().GetCtor<::Bar, int, int>();
+
+        Expect(!!barCtor && barCtor.GetDesc()->parameters.size() == 2, "::Bar(int, int) handle not resolved");
+        Expect(!barClass.GetCtor<float>(), "::Bar(float) handle should not resolve");
+        Expect(!!barClass.GetCtor(0, nullptr), "::Bar() handle not resolved");
+
+        void* handleBar = barCtor.New(ctorArgs);
+
+        Expect(static_cast<::Bar*>(handleBar)->Area() == 12, "::Bar constructed through CtorHandle mismatch");
+        Expect(Registry::Instance().Delete("::Bar", handleBar), "Failed to delete ::Bar constructed through CtorHandle");
+
+        void* pooledBars[100];
+
+        for (void*& p : pooledBars)
+            p = barCtor.New(ctorArgs);
+
+        const std::optional<ObjectPool::Stats> barPool = Registry::Instance().GetPoolStats("::Bar");
+
+        Expect(barPool && barPool->pages >= 1 && barPool->outstanding >= 100 && barPool->outstanding <= barPool->capacity, "::Bar pool occupancy mismatch");
+        Expect(!Registry::Instance().GetPoolStats("::Foo"), "::Foo should not be pooled");
+        Expect(pooledBars[0] != pooledBars[99] && static_cast<::Bar*>(pooledBars[99])->Area() == 12, "Pooled ::Bar construction mismatch");
+
+        for (void* p : pooledBars)
+            Registry::Instance().Delete("::Bar", p);
+
+        Expect(Registry::Instance().GetPoolStats("::Bar")->outstanding <= ObjectPool::MAGAZINE_CAPACITY, "Pooled ::Bar objects should return to the pool");
+
+        alignas(::Bar) std::byte barArray[sizeof(::Bar) * 4];
+
+        Expect(barClass.ConstructArray(barArray, 4, barCtor, ctorArgs), "::Bar ConstructArray failed");
+
+        ::Bar* constructedBars = std::launder(reinterpret_cast<::Bar*>(barArray));
+
+        Expect(constructedBars[0].Area() == 12 && constructedBars[3].Area() == 12, "::Bar ConstructArray broadcast mismatch");
+        Expect(barClass.DestroyArray(constructedBars, 4), "::Bar DestroyArray failed");
+        Expect(!barClass.ConstructArray(barArray, 4, barClass.GetCtor<float>(), nullptr), "ConstructArray should reject an empty constructor handle");
+        Expect(!barClass.ConstructArray(barArray, 4, ClassTypeErased{ Registry::Instance().Get<::Foo>() }.GetCtor(0, nullptr), nullptr), "ConstructArray should reject another type's constructor handle");
+
+        Expect(barDesc->isTriviallyCopyable && barDesc->isTriviallyRelocatable, "::Bar trait flags mismatch");
+
+        ::Bar relocated[3];
+
+        Expect(barClass.Relocate(relocated, bars, 3) && relocated[2].Area() == bars[2].Area(), "::Bar Relocate mismatch");
+        Expect(barClass.MoveAssign(&relocated[0], &bars[1]) && relocated[0].width == bars[1].width, "::Bar MoveAssign mismatch");
+    }
+
+    {
+        Registry& registry = Registry::Instance();
+
+        registry.Freeze();
+
+        Expect(registry.IsFrozen(), "Registry should report frozen after Freeze()");
+        Expect(registry.Get("::Foo") == fooDesc, "Frozen qualified lookup mismatch");
+        Expect(registry.Get("Foo") == fooDesc, "Frozen simple-name lookup mismatch");
+        Expect(registry.Find(fooDesc->id) == fooDesc, "Frozen id lookup mismatch");
+        Expect(registry.Get(std::type_index(typeid(::MyOtherBaseClass))) == ifaceDesc, "Frozen type_index lookup mismatch");
+        Expect(registry.GetAllBySimpleName("MyBaseClass<int>").size() == 1, "Frozen GetAllBySimpleName mismatch");
+        Expect(!registry.RegisterRange(fooDesc, fooDesc + 1), "RegisterRange should be rejected after Freeze()");
+    }
+
     std::println("All tests passed.");
 
     return 0;
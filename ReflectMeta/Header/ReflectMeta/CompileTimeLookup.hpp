@@ -14,6 +14,89 @@ namespace ReflectMeta
         }
     };
 
+    namespace Detail
+    {
+        template <typename ClassT, FixedString Name, typename Desc>
+        struct ResolvedSlot
+        {
+            inline static std::atomic<const Desc*> value[2] = {};
+        };
+
+        template <typename Desc>
+        auto Owns(std::span<const Desc> entries, const Desc* d) noexcept -> bool
+        {
+            return !entries.empty() && d >= entries.data() && d < entries.data() + entries.size();
+        }
+
+        // The slot is shared by every descriptor of ClassT, so a hit only counts when it belongs to the caller's table.
+        template <typename ClassT, FixedString Name, typename Desc, typename Resolve>
+        auto ResolveCached(std::span<const Desc> owner, bool accessibilityConsidered, Resolve&& resolve) noexcept -> const Desc*
+        {
+            std::atomic<const Desc*>& slot = ResolvedSlot<ClassT, Name, Desc>::value[accessibilityConsidered ? 1 : 0];
+
+            if (const Desc* hit = slot.load(std::memory_order_acquire); hit != nullptr && Owns(owner, hit))
+                return hit;
+
+            const Desc* hit = resolve();
+
+            if (hit != nullptr)
+                slot.store(hit, std::memory_order_release);
+
+            return hit;
+        }
+
+        template <typename PMF>
+        struct MemberFunctionTraits;
+
+        template <typename R, typename C, typename... A>
+        struct MemberFunctionTraits<R(C::*)(A...)>
+        {
+            using Return = R;
+            using Class = C;
+
+            template <template <typename...> class F>
+            using Apply = F<A...>;
+
+            static constexpr bool isConst = false;
+        };
+
+        template <typename R, typename C, typename... A>
+        struct MemberFunctionTraits<R(C::*)(A...) noexcept> : MemberFunctionTraits<R(C::*)(A...)> { };
+
+        template <typename R, typename C, typename... A>
+        struct MemberFunctionTraits<R(C::*)(A...) const> : MemberFunctionTraits<R(C::*)(A...)>
+        {
+            static constexpr bool isConst = true;
+        };
+
+        template <typename R, typename C, typename... A>
+        struct MemberFunctionTraits<R(C::*)(A...) const noexcept> : MemberFunctionTraits<R(C::*)(A...) const> { };
+
+        template <typename... A>
+        struct ParamPack { };
+
+        inline auto InheritedMember(const TypeDesc& t, bool accessibilityConsidered, std::string_view name) -> MemberTypeErased
+        {
+            const InheritedField* hit = FindInheritedField(Registry::Instance().Inherited(t), accessibilityConsidered, name);
+
+            assert(hit != nullptr && "member not found or ambiguous");
+
+            if (hit->virtualBase != nullptr)
+                return MemberTypeErased(hit->field->name, hit->field->type, 0, hit);
+
+            return MemberTypeErased(hit->field->name, hit->field->type, static_cast<size_t>(hit->offsetInBytes));
+        }
+
+        inline auto InheritedMethodOf(const TypeDesc& t, bool accessibilityConsidered, std::string_view name) -> MethodTypeErased
+        {
+            const InheritedMethod* hit = FindInheritedMethod(Registry::Instance().Inherited(t), accessibilityConsidered, name);
+
+            assert(hit != nullptr && "method not found or ambiguous");
+
+            return MethodTypeErased(*hit);
+        }
+    }
+
     template <typename ClassT>
     class ClassType
     {
@@ -29,16 +112,10 @@ namespace ReflectMeta
 
         auto GetMember(bool accessibilityConsidered, std::string_view name) const -> MemberTypeErased
         {
-            const FieldDesc* hit = nullptr;
+            if (!desc->bases.empty())
+                return Detail::InheritedMember(*desc, accessibilityConsidered, name);
 
-            for (const FieldDesc& f : desc->fields)
-            {
-                if (MatchName(accessibilityConsidered, f.access, f.name, name))
-                {
-                    hit = &f;
-                    break;
-                }
-            }
+            const FieldDesc* hit = FindField(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "member not found");
 
@@ -47,53 +124,29 @@ namespace ReflectMeta
 
         auto GetMethod(bool accessibilityConsidered, std::string_view name) const -> MethodTypeErased
         {
-            const MethodDesc* hit = nullptr;
-            
-            for (const MethodDesc& m : desc->methods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, name))
-                {
-                    hit = &m;
-                    break;
-                }
-            }
+            if (!desc->bases.empty())
+                return Detail::InheritedMethodOf(*desc, accessibilityConsidered, name);
+
+            const MethodDesc* hit = FindMethod(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "method not found");
             
-            return MethodTypeErased(hit->qualifiedName, reinterpret_cast<MethodTypeErased::Caller>(hit->erasedCaller));
+            return MethodTypeErased(hit->qualifiedName, hit->erasedCaller, hit->batchCaller, hit->emplaceCaller);
         }
 
         auto GetMethodTemplated(bool accessibilityConsidered, std::string_view name) const -> MethodTypeTemplatedErased
         {
-            const TemplatedMethodDesc* hit = nullptr;
-            
-            for (const TemplatedMethodDesc& m : desc->templatedMethods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, name))
-                {
-                    hit = &m;
-                    break;
-                }
-            }
+            const TemplatedMethodDesc* hit = FindTemplatedMethod(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "templated method not found");
             
-            return MethodTypeTemplatedErased(hit->qualifiedName, reinterpret_cast<MethodTypeTemplatedErased::ErasedTemplatedCaller>(hit->erasedTemplatedCaller));
+            return MethodTypeTemplatedErased(hit->qualifiedName, reinterpret_cast<MethodTypeTemplatedErased::ErasedTemplatedCaller>(hit->erasedTemplatedCaller), hit->specializations);
         }
 
         template <FixedString MemberName>
         auto GetMemberCT(bool accessibilityConsidered = true) const -> MemberTypeErased
         {
-            const FieldDesc* hit = nullptr;
-
-            for (const FieldDesc& f : desc->fields)
-            {
-                if (MatchName(accessibilityConsidered, f.access, f.name, NameTag<MemberName>::Value()))
-                {
-                    hit = &f;
-                    break;
-                }
-            }
+            const FieldDesc* hit = Detail::ResolveCached<ClassT, MemberName, FieldDesc>(desc->fields, accessibilityConsidered, [&] { return FindField(*desc, accessibilityConsidered, NameTag<MemberName>::Value()); });
 
             assert(hit != nullptr && "member not found");
 
@@ -103,34 +156,21 @@ namespace ReflectMeta
         template <FixedString MethodName, typename R, typename... Args>
         auto GetMethodCT(bool accessibilityConsidered = true) const -> MethodTypeTyped<R, ClassT, Args...>
         {
-            const MethodDesc* hit = nullptr; for (const MethodDesc& m : desc->methods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, NameTag<MethodName>::Value()))
-                {
-                    hit = &m; break;
-                }
-            }
+            const MethodDesc* hit = Detail::ResolveCached<ClassT, MethodName, MethodDesc>(desc->methods, accessibilityConsidered, [&] { return FindMethod(*desc, accessibilityConsidered, NameTag<MethodName>::Value()); });
 
             assert(hit != nullptr && "method not found");
 
-            using Caller = R(*)(ClassT&, Args&&...) noexcept;
-            
-            return MethodTypeTyped<R, ClassT, Args...>(hit->qualifiedName, reinterpret_cast<Caller>(hit->erasedCaller));
+            using Caller = TypedMethodCaller<R, ClassT, Args...>;
+
+            assert(hit->typedCaller != nullptr && *hit->typedSignature == typeid(Caller) && "method signature mismatch");
+
+            return MethodTypeTyped<R, ClassT, Args...>(hit->qualifiedName, static_cast<const Detail::TypedCallerHolder<Caller>*>(hit->typedCaller)->call);
         }
 
         template <FixedString MethodName, typename Binder>
         auto GetMethodTemplatedCT(bool accessibilityConsidered = true) const -> MethodTypeTemplatedTyped<Binder, ClassT>
         {
-            const TemplatedMethodDesc* hit = nullptr;
-            
-            for (const TemplatedMethodDesc& m : desc->templatedMethods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, NameTag<MethodName>::Value()))
-                {
-                    hit = &m;
-                    break;
-                }
-            }
+            const TemplatedMethodDesc* hit = Detail::ResolveCached<ClassT, MethodName, TemplatedMethodDesc>(desc->templatedMethods, accessibilityConsidered, [&] { return FindTemplatedMethod(*desc, accessibilityConsidered, NameTag<MethodName>::Value()); });
 
             assert(hit != nullptr && "templated method not found");
             
@@ -139,14 +179,6 @@ namespace ReflectMeta
 
     private:
 
-        static auto MatchName(bool accessibilityConsidered, Access memberAccess, std::string_view stored, std::string_view query) noexcept -> bool
-        {
-            if (accessibilityConsidered && memberAccess != Access::PUBLIC)
-                return false;
-            
-            return stored == query || (stored.rfind("::") != std::string_view::npos && stored.substr(stored.rfind("::") + 2) == query);
-        }
-
         static auto MakeTypedMember(const FieldDesc& f) -> MemberTypeErased
         {
             return MemberTypeErased(f.name, f.type, f.offsetInBytes);
@@ -166,16 +198,10 @@ namespace ReflectMeta
 
         auto GetMember(bool accessibilityConsidered, std::string_view name) const -> MemberTypeErased
         {
-            const FieldDesc* hit = nullptr;
+            if (!desc->bases.empty())
+                return Detail::InheritedMember(*desc, accessibilityConsidered, name);
 
-            for (const FieldDesc& f : desc->fields)
-            {
-                if (MatchName(accessibilityConsidered, f.access, f.name, name))
-                {
-                    hit = &f;
-                    break;
-                }
-            }
+            const FieldDesc* hit = FindField(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "member not found");
 
@@ -184,118 +210,195 @@ namespace ReflectMeta
 
         auto GetMethod(bool accessibilityConsidered, std::string_view name) const -> MethodTypeErased
         {
-            const MethodDesc* hit = nullptr;
+            if (!desc->bases.empty())
+                return Detail::InheritedMethodOf(*desc, accessibilityConsidered, name);
 
-            for (const MethodDesc& m : desc->methods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, name))
-                {
-                    hit = &m; break;
-                }
-            }
+            const MethodDesc* hit = FindMethod(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "method not found");
 
-            return MethodTypeErased(hit->qualifiedName, reinterpret_cast<MethodTypeErased::Caller>(hit->erasedCaller));
+            return MethodTypeErased(hit->qualifiedName, hit->erasedCaller, hit->batchCaller, hit->emplaceCaller);
         }
 
         auto GetMethodTemplated(bool accessibilityConsidered, std::string_view name) const -> MethodTypeTemplatedErased
         {
-            const TemplatedMethodDesc* hit = nullptr;
-
-            for (const TemplatedMethodDesc& m : desc->templatedMethods)
-            {
-                if (MatchName(accessibilityConsidered, m.access, m.name, name))
-                {
-                    hit = &m;
-                    break;
-                }
-            }
+            const TemplatedMethodDesc* hit = FindTemplatedMethod(*desc, accessibilityConsidered, name);
 
             assert(hit != nullptr && "templated method not found");
 
-            return MethodTypeTemplatedErased(hit->qualifiedName, reinterpret_cast<MethodTypeTemplatedErased::ErasedTemplatedCaller>(hit->erasedTemplatedCaller));
+            return MethodTypeTemplatedErased(hit->qualifiedName, reinterpret_cast<MethodTypeTemplatedErased::ErasedTemplatedCaller>(hit->erasedTemplatedCaller), hit->specializations);
         }
 
         auto ConstructInto(void* storage, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) const -> bool
         {
-            const CtorDesc* c = FindCtor(argc, argTypes, accessibilityConsidered); if (!c) return false; c->erasedCtor(storage, args); return true;
+            const CtorDesc* c = ReflectMeta::FindCtor(*desc, accessibilityConsidered, argc, argTypes); if (!c) return false; c->erasedCtor(storage, args); return true;
+        }
+
+        auto GetCtor(size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) const -> CtorHandle
+        {
+            return CtorHandle(*desc, ReflectMeta::FindCtor(*desc, accessibilityConsidered, argc, argTypes));
+        }
+
+        template <typename... Args>
+        auto GetCtor(bool accessibilityConsidered = true) const -> CtorHandle
+        {
+            return GetCtor(sizeof...(Args), Detail::CtorArgTypes<Args...>::value, accessibilityConsidered);
         }
 
         auto New(void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) const -> void*
         {
-            void* mem = ::operator new(desc->sizeInBytes, std::align_val_t(desc->alignInBytes)); if (!ConstructInto(mem, args, argc, argTypes, accessibilityConsidered)) { ::operator delete(mem, std::align_val_t(desc->alignInBytes)); return nullptr; } return mem;
+            void* mem = AllocateObject(*desc); if (!ConstructInto(mem, args, argc, argTypes, accessibilityConsidered)) { FreeObject(*desc, mem); return nullptr; } return mem;
         }
 
         auto Delete(void* p, bool accessibilityConsidered = true) const -> bool
         {
-            if (!desc->destructor.has_value()) return false; const DtorDesc& d = *desc->destructor; if (accessibilityConsidered && d.access != Access::PUBLIC) return false; d.erasedDtor(p); ::operator delete(p, std::align_val_t(desc->alignInBytes)); return true;
+            if (!desc->destructor.has_value()) return false; const DtorDesc& d = *desc->destructor; if (accessibilityConsidered && d.access != Access::PUBLIC) return false; d.erasedDtor(p); FreeObject(*desc, p); return true;
         }
 
-    private:
+        auto ConstructArray(void* storage, size_t count, const CtorHandle& ctor, void** args) const -> bool
+        {
+            if (!ctor || !Detail::Owns(desc->constructors, ctor.GetDesc()))
+                return false;
 
-        const CtorDesc* FindCtor(size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) const
+            ctor.ConstructArray(storage, count, args);
+
+            return true;
+        }
+
+        auto DestroyArray(void* p, size_t count, bool accessibilityConsidered = true) const -> bool
         {
-            auto matchQual = [&](const QualTypeInfo& q, const std::type_info& ti) noexcept -> bool
-                {
-                    return q.qualifiedName == std::string_view(ti.name());
-                };
+            if (!desc->destructor.has_value())
+                return false;
 
-            for (const CtorDesc& c : desc->constructors)
-            {
-                if (accessibilityConsidered && c.access != Access::PUBLIC)
-                    continue;
+            const DtorDesc& d = *desc->destructor;
 
-                if (c.parameters.size() != argc)
-                    continue;
+            if (accessibilityConsidered && d.access != Access::PUBLIC)
+                return false;
 
-                bool ok = true;
-                
-                for (size_t i = 0; i < argc; ++i)
-                {
-                    if (!matchQual(c.parameters[i].type, *argTypes[i]))
-                    {
-                        ok = false;
-                        break;
-                    }
-                }
+            if (desc->isTriviallyDestructible)
+                return true;
 
-                if (ok)
-                    return &c;
+            if (d.erasedArrayDtor != nullptr)
+                d.erasedArrayDtor(p, count);
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                    d.erasedDtor(static_cast<std::byte*>(p) + i * desc->sizeInBytes);
             }
 
-            return nullptr;
+            return true;
+        }
+
+        auto CopyConstruct(void* dst, const void* src, size_t count = 1) const noexcept -> bool
+        {
+            if (!desc->valueOps.copyConstruct)
+                return false;
+
+            if (desc->isTriviallyCopyable)
+                std::memcpy(dst, src, count * desc->sizeInBytes);
+            else
+                desc->valueOps.copyConstruct(dst, src, count);
+
+            return true;
+        }
+
+        auto MoveConstruct(void* dst, void* src, size_t count = 1) const noexcept -> bool
+        {
+            if (!desc->valueOps.moveConstruct)
+                return false;
+
+            if (desc->isTriviallyCopyable)
+                std::memcpy(dst, src, count * desc->sizeInBytes);
+            else
+                desc->valueOps.moveConstruct(dst, src, count);
+
+            return true;
+        }
+
+        auto CopyAssign(void* dst, const void* src, size_t count = 1) const noexcept -> bool
+        {
+            if (!desc->valueOps.copyAssign)
+                return false;
+
+            if (desc->isTriviallyCopyable)
+                std::memcpy(dst, src, count * desc->sizeInBytes);
+            else
+                desc->valueOps.copyAssign(dst, src, count);
+
+            return true;
         }
 
-        static auto MatchName(bool accessibilityConsidered, Access memberAccess, std::string_view stored, std::string_view query) noexcept -> bool
+        auto MoveAssign(void* dst, void* src, size_t count = 1) const noexcept -> bool
         {
-            if (accessibilityConsidered && memberAccess != Access::PUBLIC)
+            if (!desc->valueOps.moveAssign)
                 return false;
 
-            return stored == query || (stored.rfind("::") != std::string_view::npos && stored.substr(stored.rfind("::") + 2) == query);
+            if (desc->isTriviallyCopyable)
+                std::memcpy(dst, src, count * desc->sizeInBytes);
+            else
+                desc->valueOps.moveAssign(dst, src, count);
+
+            return true;
         }
 
+        auto Relocate(void* dst, void* src, size_t count = 1) const noexcept -> bool
+        {
+            if (desc->isTriviallyRelocatable)
+            {
+                std::memcpy(dst, src, count * desc->sizeInBytes);
+
+                return true;
+            }
+
+            if (!desc->valueOps.relocate)
+                return false;
+
+            desc->valueOps.relocate(dst, src, count);
+
+            return true;
+        }
+
+    private:
+
         const TypeDesc* desc;
     };
 
+    template <typename ClassT>
+    class StaticTypeHierarchy;
+
     class TypeHierarchy
     {
 
+        template <typename ClassT>
+        friend class StaticTypeHierarchy;
+
     public:
 
-        static auto New() -> TypeHierarchy&
+        TypeHierarchy(TypeHierarchy&&) noexcept = default;
+        TypeHierarchy& operator=(TypeHierarchy&&) noexcept = default;
+
+        TypeHierarchy(const TypeHierarchy&) = delete;
+        TypeHierarchy& operator=(const TypeHierarchy&) = delete;
+
+        static auto New() -> TypeHierarchy
         {
-            static TypeHierarchy th;
-            
-            th.Reset();
-            return th;
+            return TypeHierarchy{};
+        }
+
+        ~TypeHierarchy()
+        {
+            if (scratch == nullptr)
+                return;
+
+            scratch->Clear();
+            SpareScratch().push_back(std::move(scratch));
         }
 
         template <typename ClassT>
-        auto Struct(std::string_view qualifiedName) -> TypeHierarchy&
+        auto Struct(HashedName qualifiedName) -> TypeHierarchy&
         {
-            current.qualifiedName = qualifiedName;
-            current.name = qualifiedName.substr(qualifiedName.rfind("::") == std::string_view::npos ? 0 : qualifiedName.rfind("::") + 2);
+            current.qualifiedName = qualifiedName.name;
+            current.name = SimpleNameOf(qualifiedName.name);
             current.isStruct = true;
             current.isClass = false;
             current.isUnion = false;
@@ -303,24 +406,51 @@ namespace ReflectMeta
             current.sizeInBytes = sizeof(ClassT);
             current.alignInBytes = alignof(ClassT);
             current.isPolymorphic = std::is_polymorphic_v<ClassT>;
-            current.id = HashName(qualifiedName);
+            current.id = qualifiedName.id;
+            current.typeInfo = &typeid(ClassT);
+            current.isTriviallyCopyable = std::is_trivially_copyable_v<ClassT>;
+            current.isTriviallyDestructible = std::is_trivially_destructible_v<ClassT>;
+            current.isTriviallyRelocatable = std::is_trivially_copyable_v<ClassT>;
+            current.valueOps = ValueOpsOf<ClassT>();
             
             return *this;
         }
 
-        template <Access A, typename DerivedT, typename BaseT>
-        auto Base(std::string_view baseQualifiedName, bool isVirtual) -> TypeHierarchy&
+        auto Pooled() -> TypeHierarchy&
+        {
+            current.isPooled = true;
+
+            return *this;
+        }
+
+        auto TriviallyRelocatable() -> TypeHierarchy&
         {
+            current.isTriviallyRelocatable = true;
+
+            return *this;
+        }
+
+        template <Access A, typename DerivedT, typename BaseT, bool IsVirtual = false>
+        auto Base(HashedName baseQualifiedName) -> TypeHierarchy&
+        {
+            static_assert(IsVirtual == Detail::VirtualBaseOf<DerivedT, BaseT>, "base must be registered with IsVirtual matching its declaration");
+
             BaseDesc b;
 
-            b.baseTypeId = HashName(baseQualifiedName);
+            b.baseTypeId = baseQualifiedName.id;
             b.offsetInBytes = 0;
-            b.isVirtual = isVirtual;
+            b.isVirtual = IsVirtual;
             b.access = A;
-            b.adjustPtr = +[](void* p) noexcept -> void* { return static_cast<BaseT*>(static_cast<DerivedT*>(p)); };
-            b.adjustConstPtr = +[](const void* p) noexcept -> const void* { return static_cast<const BaseT*>(static_cast<const DerivedT*>(p)); };
+            b.adjustPtr = &AdjustToBase<DerivedT, BaseT>;
+            b.adjustConstPtr = &AdjustToConstBase<DerivedT, BaseT>;
+
+            if constexpr (!IsVirtual)
+            {
+                b.offsetOf = &Detail::BaseOffsetOf<DerivedT, BaseT>;
+                b.offsetInBytes = b.offsetOf();
+            }
             
-            current.bases.push_back(b);
+            scratch->bases.push_back(b);
             
             return *this;
         }
@@ -330,83 +460,32 @@ namespace ReflectMeta
         {
             FieldDesc f{ qualifiedMemberName, QualOf<MemberT>(), offset, false, 0, A };
             
-            current.fields.push_back(f);
+            scratch->fields.push_back(f);
             return *this;
         }
         
-        template <Access A, Qualifiers Q, typename R, typename ClassT, typename... Args>
-        auto Method(std::string_view qualifiedName, R(ClassT::* pmf)(Args...) noexcept, bool isVirtual = false, bool isStatic = false) -> TypeHierarchy&
-        {
-            MethodDesc m;
-            
-            m.name = qualifiedName.substr(qualifiedName.rfind("::") == std::string_view::npos ? 0 : qualifiedName.rfind("::") + 2);
-            m.qualifiedName = qualifiedName;
-            m.returnType = QualOf<R>();
-            m.access = A;
-            m.qualifiers = Q;
-            m.parameters = ParamsOf<Args...>();
-            m.isVirtual = isVirtual;
-            m.isStatic = isStatic;
-            m.isDeleted = false;
-            m.isDefaulted = false;
-            m.isPureVirtual = false;
-
-            static R(ClassT:: * s_pmf)(Args...) noexcept = pmf;
-            m.erasedCaller = reinterpret_cast<void*>(+[](void* self, void** args, void* retOut) noexcept -> void { CallPMF<R, ClassT, Args...>(s_pmf, self, args, retOut); });
-
-            current.methods.push_back(std::move(m));
-            
-            return *this;
-        }
-
-        template <Access A, Qualifiers Q, typename R, typename ClassT, typename... Args>
-        auto Method(std::string_view qualifiedName, R(ClassT::* pmf)(Args...), bool isVirtual = false, bool isStatic = false) -> TypeHierarchy&
+        template <Access A, Qualifiers Q, auto PMF>
+        auto Method(std::string_view qualifiedName, bool isVirtual = false, bool isStatic = false) -> TypeHierarchy&
         {
-            MethodDesc m;
-            
-            m.name = qualifiedName.substr(qualifiedName.rfind("::") == std::string_view::npos ? 0 : qualifiedName.rfind("::") + 2);
-            m.qualifiedName = qualifiedName;
-            m.returnType = QualOf<R>();
-            m.access = A;
-            m.qualifiers = Q;
-            m.parameters = ParamsOf<Args...>();
-            m.isVirtual = isVirtual;
-            m.isStatic = isStatic;
-            m.isDeleted = false;
-            m.isDefaulted = false;
-            m.isPureVirtual = false;
+            using Traits = Detail::MemberFunctionTraits<decltype(PMF)>;
 
-            static R(ClassT:: * s_pmf)(Args...) = pmf;
-            
-            m.erasedCaller = reinterpret_cast<void*>(+[](void* self, void** args, void* retOut) noexcept -> void { CallPMF<R, ClassT, Args...>(s_pmf, self, args, retOut); });
-
-            current.methods.push_back(std::move(m));
-           
-            return *this;
-        }
-
-        template <Access A, Qualifiers Q, typename R, typename ClassT, typename... Args>
-        auto Method(std::string_view qualifiedName, R(ClassT::* pmf)(Args...) const, bool isVirtual = false, bool isStatic = false) -> TypeHierarchy&
-        {
             MethodDesc m;
             
-            m.name = qualifiedName.substr(qualifiedName.rfind("::") == std::string_view::npos ? 0 : qualifiedName.rfind("::") + 2);
+            m.name = SimpleNameOf(qualifiedName);
             m.qualifiedName = qualifiedName;
-            m.returnType = QualOf<R>();
+            m.returnType = QualOf<typename Traits::Return>();
             m.access = A;
             m.qualifiers = Q;
-            m.parameters = ParamsOf<Args...>();
+            scratch->methodParamRanges.push_back(AppendParams(typename Traits::template Apply<Detail::ParamPack>{}));
             m.isVirtual = isVirtual;
             m.isStatic = isStatic;
             m.isDeleted = false;
             m.isDefaulted = false;
             m.isPureVirtual = false;
 
-            static R(ClassT:: * s_pmf)(Args...) const = pmf;
-            
-            m.erasedCaller = reinterpret_cast<void*>(+[](void* self, void** args, void* retOut) noexcept -> void { CallPMFConst<R, ClassT, Args...>(s_pmf, self, args, retOut); });
+            SetCallers<PMF>(m);
 
-            current.methods.push_back(std::move(m));
+            scratch->methods.push_back(m);
             
             return *this;
         }
@@ -421,7 +500,7 @@ namespace ReflectMeta
             m.returnType = QualOf<R>();
             m.access = A;
             m.qualifiers = Q;
-            m.parameters = ParamsOf<Args...>();
+            scratch->methodParamRanges.push_back(AppendParams<Args...>());
             m.isVirtual = true;
             m.isStatic = false;
             m.isDeleted = false;
@@ -429,13 +508,13 @@ namespace ReflectMeta
             m.isPureVirtual = true;
             m.erasedCaller = nullptr;
 
-            current.methods.push_back(std::move(m));
+            scratch->methods.push_back(m);
 
             return *this;
         }
 
         template <TypenameType TT, typename TemplateTypeExpr, Access A, Qualifiers Q, typename R, typename ClassT, typename... FormalArgs>
-        auto MethodTemplated(std::string_view qualifiedName, MethodTypeTemplatedErased::ErasedTemplatedCaller caller = nullptr) -> TypeHierarchy&
+        auto MethodTemplated(std::string_view qualifiedName, MethodTypeTemplatedErased::ErasedTemplatedCaller caller = nullptr, size_t templateArity = 1) -> TypeHierarchy&
         {
             TemplatedMethodDesc t;
 
@@ -443,11 +522,12 @@ namespace ReflectMeta
             t.qualifiedName = qualifiedName;
             t.access = A;
             t.qualifiers = Q;
-            t.templateDisplay = "<typename T>";
+            t.templateDisplay = TemplateDisplayOf(templateArity);
+            t.templateArity = templateArity;
             t.erasedTemplatedCaller = reinterpret_cast<void*>(caller);
             t.binderTag = nullptr;
 
-            current.templatedMethods.push_back(std::move(t));
+            scratch->templatedMethods.push_back(t);
             return *this;
         }
 
@@ -457,7 +537,7 @@ namespace ReflectMeta
             CtorDesc c;
 
             c.qualifiedName = std::string_view(current.qualifiedName);
-            c.parameters = ParamsOf<Args...>();
+            scratch->ctorParamRanges.push_back(AppendParams<Args...>());
             c.access = A;
             c.isExplicit = Explicit;
 
@@ -467,11 +547,12 @@ namespace ReflectMeta
                     {
                         CallCtor<ClassT, Args...>(storage, args);
                     };
+                c.erasedArrayCtor = &CallCtorArray<ClassT, Args...>;
             }
             else
                 c.erasedCtor = nullptr;
 
-            current.constructors.push_back(std::move(c));
+            scratch->constructors.push_back(c);
 
             return *this;
         }
@@ -486,38 +567,37 @@ namespace ReflectMeta
             d.isVirtual = std::has_virtual_destructor_v<ClassT>;
             d.isNoexcept = std::is_nothrow_destructible_v<ClassT>;
             d.erasedDtor = +[](void* obj) noexcept -> void { CallDtor<ClassT>(obj); };
+            d.erasedArrayDtor = &CallDtorArray<ClassT>;
 
             current.destructor = d;
 
             return *this;
         }
 
-        auto Commit() -> const TypeDesc&
+        auto Commit() -> TypeDesc
         {
-            types.push_back(current);
-            
-            return types.back();
-        }
+            using Region = DescriptorArena::Region;
 
-        auto Reset() -> void
-        {
-            current = TypeDesc{};
-        }
+            DescriptorArena& arena = DescriptorArena::Module();
+            std::span<const MethodParam> params = arena.Copy(scratch->params, Region::COLD);
 
-        auto Get(std::string_view qualifiedName) const -> const TypeDesc*
-        {
-            for (const TypeDesc& t : types)
-            {
-                if (t.qualifiedName == qualifiedName)
-                    return &t;
-            }
+            for (size_t i = 0; i < scratch->methods.size(); ++i)
+                scratch->methods[i].parameters = params.subspan(scratch->methodParamRanges[i].first, scratch->methodParamRanges[i].second);
 
-            return nullptr;
-        }
+            for (size_t i = 0; i < scratch->constructors.size(); ++i)
+                scratch->constructors[i].parameters = params.subspan(scratch->ctorParamRanges[i].first, scratch->ctorParamRanges[i].second);
 
-        auto All() const -> const std::vector<TypeDesc>&
-        {
-            return types;
+            current.fields = arena.Copy(scratch->fields, Region::HOT);
+            current.methods = arena.Copy(scratch->methods, Region::HOT);
+            current.constructors = arena.Copy(scratch->constructors, Region::HOT);
+            current.bases = arena.Copy(scratch->bases, Region::HOT);
+            current.templatedMethods = arena.Copy(scratch->templatedMethods, Region::COLD);
+
+            TypeDesc committed = std::exchange(current, TypeDesc{});
+
+            scratch->Clear();
+
+            return committed;
         }
 
     private:
@@ -526,9 +606,9 @@ namespace ReflectMeta
         static auto QualOf() -> QualTypeInfo
         {
             if constexpr (std::is_same_v<T, void>)
-                return QualTypeInfo{ TypeName<T>(), TypeName<T>(), 0, 0, std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T> };
+                return QualTypeInfo{ TypeName<T>(), TypeName<T>(), 0, 0, std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T>, &typeid(T) };
             else
-                return QualTypeInfo{ TypeName<T>(), TypeName<T>(), sizeof(T), alignof(T), std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T> };
+                return QualTypeInfo{ TypeName<T>(), TypeName<T>(), sizeof(T), alignof(T), std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T>, &typeid(T) };
         }
 
         template <typename T>
@@ -538,13 +618,19 @@ namespace ReflectMeta
         }
 
         template <typename... A>
-        static auto ParamsOf() -> std::vector<MethodParam>
+        auto AppendParams() -> std::pair<size_t, size_t>
         {
-            std::vector<MethodParam> v;
+            const size_t first = scratch->params.size();
             
-            (v.push_back(MethodParam{ std::string_view(), QualOf<A>() }), ...);
+            (scratch->params.push_back(MethodParam{ std::string_view(), QualOf<A>() }), ...);
             
-            return v; 
+            return { first, sizeof...(A) };
+        }
+
+        template <typename... A>
+        auto AppendParams(Detail::ParamPack<A...>) -> std::pair<size_t, size_t>
+        {
+            return AppendParams<A...>();
         }
 
         template <typename R, typename C, typename... A, std::size_t... I>
@@ -631,28 +717,567 @@ namespace ReflectMeta
             CallCtorIndexed<C, A...>(storage, args, std::index_sequence_for<A...>{});
         }
 
+        template <typename C, typename... A>
+        static auto CallCtorArray(void* storage, size_t count, void** args) noexcept -> void
+        {
+            if constexpr (sizeof...(A) == 0 && std::is_trivially_default_constructible_v<C>)
+                std::memset(storage, 0, count * sizeof(C));
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                    CallCtorIndexed<C, A...>(static_cast<C*>(storage) + i, args, std::index_sequence_for<A...>{});
+            }
+        }
+
         template <typename C>
         static auto CallDtor(void* obj) noexcept -> void
         {
             reinterpret_cast<C*>(obj)->~C();
         }
 
-        static auto HashName(std::string_view qn) -> TypeId
+        template <typename C>
+        static auto CallDtorArray(void* obj, size_t count) noexcept -> void
         {
-            uint64_t h1 = 1469598103934665603ull;
-            uint64_t h2 = 1099511628211ull;
-            
-            for (char c : qn)
+            if constexpr (!std::is_trivially_destructible_v<C>)
+                std::destroy_n(static_cast<C*>(obj), count);
+        }
+
+        template <typename C>
+        static auto CopyConstructN(void* dst, const void* src, size_t count) noexcept -> void
+        {
+            if constexpr (std::is_trivially_copy_constructible_v<C>)
+                std::memcpy(dst, src, count * sizeof(C));
+            else
+                std::uninitialized_copy_n(static_cast<const C*>(src), count, static_cast<C*>(dst));
+        }
+
+        template <typename C>
+        static auto MoveConstructN(void* dst, void* src, size_t count) noexcept -> void
+        {
+            if constexpr (std::is_trivially_move_constructible_v<C>)
+                std::memcpy(dst, src, count * sizeof(C));
+            else
+                std::uninitialized_move_n(static_cast<C*>(src), count, static_cast<C*>(dst));
+        }
+
+        template <typename C>
+        static auto CopyAssignN(void* dst, const void* src, size_t count) noexcept -> void
+        {
+            if constexpr (std::is_trivially_copy_assignable_v<C>)
+                std::memcpy(dst, src, count * sizeof(C));
+            else
+                std::copy_n(static_cast<const C*>(src), count, static_cast<C*>(dst));
+        }
+
+        template <typename C>
+        static auto MoveAssignN(void* dst, void* src, size_t count) noexcept -> void
+        {
+            if constexpr (std::is_trivially_move_assignable_v<C>)
+                std::memcpy(dst, src, count * sizeof(C));
+            else
+                std::move(static_cast<C*>(src), static_cast<C*>(src) + count, static_cast<C*>(dst));
+        }
+
+        template <typename C>
+        static auto RelocateN(void* dst, void* src, size_t count) noexcept -> void
+        {
+            if constexpr (std::is_trivially_copyable_v<C>)
+                std::memcpy(dst, src, count * sizeof(C));
+            else
             {
-                h1 ^= static_cast<uint8_t>(c);
-                h1 *= h2;
+                C* from = static_cast<C*>(src);
+                C* to = static_cast<C*>(dst);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    ::new (static_cast<void*>(to + i)) C(std::move(from[i]));
+                    from[i].~C();
+                }
+            }
+        }
+
+        template <typename DerivedT, typename BaseT>
+        static auto AdjustToBase(void* p) noexcept -> void*
+        {
+            BaseT* base = static_cast<DerivedT*>(p);
+
+            return base;
+        }
+
+        template <typename DerivedT, typename BaseT>
+        static auto AdjustToConstBase(const void* p) noexcept -> const void*
+        {
+            const BaseT* base = static_cast<const DerivedT*>(p);
+
+            return base;
+        }
+
+        template <typename C>
+        static constexpr auto ValueOpsOf() noexcept -> ValueOps
+        {
+            ValueOps ops;
+
+            if constexpr (std::is_copy_constructible_v<C>)
+                ops.copyConstruct = &CopyConstructN<C>;
+
+            if constexpr (std::is_move_constructible_v<C>)
+                ops.moveConstruct = &MoveConstructN<C>;
+
+            if constexpr (std::is_copy_assignable_v<C>)
+                ops.copyAssign = &CopyAssignN<C>;
+
+            if constexpr (std::is_move_assignable_v<C>)
+                ops.moveAssign = &MoveAssignN<C>;
+
+            if constexpr (std::is_move_constructible_v<C> && std::is_destructible_v<C>)
+                ops.relocate = &RelocateN<C>;
+
+            return ops;
+        }
+
+        template <typename R, typename C, typename... A, typename PMF, std::size_t... I>
+        static auto CallPMFEmplaceIndexed(PMF pmf, void* self, void** args, void* retStorage, std::index_sequence<I...>) noexcept -> void
+        {
+            C* obj = reinterpret_cast<C*>(self);
+
+            if constexpr (std::is_reference_v<R>)
+                *static_cast<std::remove_reference_t<R>**>(retStorage) = std::addressof((obj->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(args[I])...));
+            else if constexpr (!std::is_void_v<R>)
+                ::new (retStorage) std::remove_cv_t<R>((obj->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(args[I])...));
+            else
+                (obj->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(args[I])...);
+        }
+
+        template <typename R, typename C, typename... A, typename PMF>
+        static auto CallPMFEmplace(PMF pmf, void* self, void** args, void* retStorage) noexcept -> void
+        {
+            CallPMFEmplaceIndexed<R, C, A...>(pmf, self, args, retStorage, std::index_sequence_for<A...>{});
+        }
+
+        template <typename R, typename C, typename... A, typename PMF, std::size_t... I>
+        static auto CallPMFBatchIndexed(PMF pmf, const BatchInvocation& batch, std::index_sequence<I...>) noexcept -> void
+        {
+            const size_t strides[] = { (batch.argStrides != nullptr ? batch.argStrides[I] : 0)..., 0 };
+
+            for (size_t i = 0; i < batch.count; ++i)
+            {
+                C* self = reinterpret_cast<C*>(batch.objects != nullptr ? static_cast<std::byte*>(batch.objects[i]) : batch.objectBase + i * batch.objectStride);
+
+                if constexpr (!std::is_void_v<R>)
+                {
+                    using Store = std::remove_cvref_t<R>;
+
+                    if (batch.retOut != nullptr)
+                        *reinterpret_cast<Store*>(batch.retOut + i * batch.retStride) = (self->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(static_cast<std::byte*>(batch.args[I]) + i * strides[I])...);
+                    else
+                        (void)(self->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(static_cast<std::byte*>(batch.args[I]) + i * strides[I])...);
+                }
+                else
+                    (self->*pmf)(*reinterpret_cast<std::remove_reference_t<A>*>(static_cast<std::byte*>(batch.args[I]) + i * strides[I])...);
+            }
+        }
+
+        template <typename R, typename C, typename... A, typename PMF>
+        static auto CallPMFBatch(PMF pmf, const BatchInvocation& batch) noexcept -> void
+        {
+            CallPMFBatchIndexed<R, C, A...>(pmf, batch, std::index_sequence_for<A...>{});
+        }
+
+        static constexpr auto HashName(std::string_view qn) -> TypeId
+        {
+            return TypeIdOf(qn);
+        }
+
+        template <auto PMF>
+        struct TypedThunk
+        {
+            using R = typename Detail::MemberFunctionTraits<decltype(PMF)>::Return;
+            using ClassT = typename Detail::MemberFunctionTraits<decltype(PMF)>::Class;
+
+            template <typename... A>
+            struct Of
+            {
+                using Caller = TypedMethodCaller<R, ClassT, A...>;
+
+                static auto Call(ClassT& self, A... args) noexcept -> R
+                {
+                    return (self.*PMF)(static_cast<A&&>(args)...);
+                }
+
+                static constexpr Detail::TypedCallerHolder<Caller> holder{ &Call };
+            };
+        };
+
+        template <auto PMF>
+        static auto BatchThunk(const BatchInvocation& batch) noexcept -> void
+        {
+            using Traits = Detail::MemberFunctionTraits<decltype(PMF)>;
+            using Self = std::conditional_t<Traits::isConst, const typename Traits::Class, typename Traits::Class>;
+
+            Traits::template Apply<CallWithArgs>::template Run<typename Traits::Return, Self>(PMF, batch);
+        }
+
+        template <auto PMF>
+        static auto EmplaceThunk(void* self, void** args, void* retStorage) noexcept -> void
+        {
+            using Traits = Detail::MemberFunctionTraits<decltype(PMF)>;
+            using Self = std::conditional_t<Traits::isConst, const typename Traits::Class, typename Traits::Class>;
+
+            Traits::template Apply<CallWithArgs>::template Emplace<typename Traits::Return, Self>(PMF, self, args, retStorage);
+        }
+
+        template <typename... A>
+        struct CallWithArgs
+        {
+            template <typename R, typename C, typename PMF>
+            static auto Run(PMF pmf, const BatchInvocation& batch) noexcept -> void
+            {
+                CallPMFBatch<R, C, A...>(pmf, batch);
+            }
+
+            template <typename R, typename C, typename PMF>
+            static auto Emplace(PMF pmf, void* self, void** args, void* retStorage) noexcept -> void
+            {
+                CallPMFEmplace<R, C, A...>(pmf, self, args, retStorage);
+            }
+        };
+
+        template <auto PMF>
+        static auto ErasedThunk(void* self, void** args, void* retOut) noexcept -> void
+        {
+            if constexpr (Detail::MemberFunctionTraits<decltype(PMF)>::isConst)
+                CallPMFConst(PMF, self, args, retOut);
+            else
+                CallPMF(PMF, self, args, retOut);
+        }
+
+        template <auto PMF>
+        static constexpr auto SetCallers(MethodDesc& m) -> void
+        {
+            using Traits = Detail::MemberFunctionTraits<decltype(PMF)>;
+            using Typed = typename Traits::template Apply<TypedThunk<PMF>::template Of>;
+
+            m.erasedCaller = &ErasedThunk<PMF>;
+            m.typedCaller = &Typed::holder;
+            m.typedSignature = &typeid(typename Typed::Caller);
+            m.batchCaller = &BatchThunk<PMF>;
+            m.emplaceCaller = &EmplaceThunk<PMF>;
+        }
+
+        struct Scratch
+        {
+            std::vector<FieldDesc> fields;
+            std::vector<MethodDesc> methods;
+            std::vector<TemplatedMethodDesc> templatedMethods;
+            std::vector<BaseDesc> bases;
+            std::vector<CtorDesc> constructors;
+            std::vector<MethodParam> params;
+            std::vector<std::pair<size_t, size_t>> methodParamRanges;
+            std::vector<std::pair<size_t, size_t>> ctorParamRanges;
+
+            auto Clear() -> void
+            {
+                fields.clear();
+                methods.clear();
+                templatedMethods.clear();
+                bases.clear();
+                constructors.clear();
+                params.clear();
+                methodParamRanges.clear();
+                ctorParamRanges.clear();
+            }
+        };
+
+        static auto SpareScratch() -> std::vector<std::unique_ptr<Scratch>>&
+        {
+            thread_local std::vector<std::unique_ptr<Scratch>> spare;
+
+            return spare;
+        }
+
+        TypeHierarchy()
+        {
+            std::vector<std::unique_ptr<Scratch>>& spare = SpareScratch();
+
+            if (spare.empty())
+                scratch = std::make_unique<Scratch>();
+            else
+            {
+                scratch = std::move(spare.back());
+                spare.pop_back();
             }
-            
-            return TypeId{ h1, ~h1 };
         }
 
         TypeDesc current;
-        std::vector<TypeDesc> types;
+        std::unique_ptr<Scratch> scratch;
+    };
+
+    namespace Detail
+    {
+        template <typename T>
+        constexpr auto RawTypeSignature() noexcept -> std::string_view
+        {
+#if defined(_MSC_VER)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        template <typename T>
+        constexpr auto ExtractTypeName() noexcept -> std::string_view
+        {
+            const std::string_view signature = RawTypeSignature<T>();
+
+#if defined(_MSC_VER)
+            const size_t begin = signature.find("RawTypeSignature<") + 17;
+            const size_t end = signature.rfind(">(void)");
+#else
+            const size_t begin = signature.find("T = ") + 4;
+            const size_t end = signature.find_first_of(";]", begin);
+#endif
+
+            return signature.substr(begin, end - begin);
+        }
+
+        template <typename T>
+        struct StaticTypeName
+        {
+            static constexpr auto storage = []
+                {
+                    std::array<char, ExtractTypeName<T>().size()> chars{};
+
+                    for (size_t i = 0; i < chars.size(); ++i)
+                        chars[i] = ExtractTypeName<T>()[i];
+
+                    return chars;
+                }();
+
+            static constexpr std::string_view value{ storage.data(), storage.size() };
+        };
+    }
+
+    struct StaticTypeTables
+    {
+        std::span<const FieldDesc> fields;
+        std::span<const MethodDesc> methods;
+        std::span<TemplatedMethodDesc> templatedMethods;
+        std::span<const BaseDesc> bases;
+        std::span<const CtorDesc> constructors;
+        std::optional<DtorDesc> destructor;
+        bool isPooled = false;
+        bool isTriviallyRelocatable = false;
+    };
+
+    template <typename ClassT>
+    class StaticTypeHierarchy
+    {
+
+    public:
+
+        static consteval auto Struct(std::string_view qualifiedName, const StaticTypeTables& tables) -> TypeDesc
+        {
+            TypeDesc t;
+
+            t.id = TypeHierarchy::HashName(qualifiedName);
+            t.qualifiedName = qualifiedName;
+            t.name = SimpleNameOf(qualifiedName);
+            t.isStruct = true;
+            t.isClass = false;
+            t.isUnion = false;
+            t.isEnum = false;
+            t.sizeInBytes = sizeof(ClassT);
+            t.alignInBytes = alignof(ClassT);
+            t.typeInfo = &typeid(ClassT);
+            t.isPolymorphic = std::is_polymorphic_v<ClassT>;
+            t.isTriviallyCopyable = std::is_trivially_copyable_v<ClassT>;
+            t.isTriviallyDestructible = std::is_trivially_destructible_v<ClassT>;
+            t.isTriviallyRelocatable = std::is_trivially_copyable_v<ClassT> || tables.isTriviallyRelocatable;
+            t.valueOps = TypeHierarchy::ValueOpsOf<ClassT>();
+            t.fields = tables.fields;
+            t.methods = tables.methods;
+            t.templatedMethods = tables.templatedMethods;
+            t.bases = tables.bases;
+            t.constructors = tables.constructors;
+            t.destructor = tables.destructor;
+            t.isPooled = tables.isPooled;
+
+            return t;
+        }
+
+        template <Access A, typename BaseT, bool IsVirtual = false>
+        static consteval auto Base(std::string_view baseQualifiedName) -> BaseDesc
+        {
+            static_assert(IsVirtual == Detail::VirtualBaseOf<ClassT, BaseT>, "base must be registered with IsVirtual matching its declaration");
+
+            BaseDesc b;
+
+            b.baseTypeId = TypeHierarchy::HashName(baseQualifiedName);
+            b.offsetInBytes = IsVirtual ? 0 : BaseDesc::UNRESOLVED_OFFSET;
+            b.isVirtual = IsVirtual;
+            b.access = A;
+            b.adjustPtr = &TypeHierarchy::AdjustToBase<ClassT, BaseT>;
+            b.adjustConstPtr = &TypeHierarchy::AdjustToConstBase<ClassT, BaseT>;
+
+            if constexpr (!IsVirtual)
+                b.offsetOf = &Detail::BaseOffsetOf<ClassT, BaseT>;
+
+            return b;
+        }
+
+        template <Access A, typename MemberT>
+        static consteval auto Member(std::string_view qualifiedMemberName, size_t offset) -> FieldDesc
+        {
+            return FieldDesc{ qualifiedMemberName, QualOf<MemberT>(), offset, false, 0, A };
+        }
+
+        template <Access A, Qualifiers Q, auto PMF>
+        static consteval auto Method(std::string_view qualifiedName, bool isVirtual = false, bool isStatic = false) -> MethodDesc
+        {
+            using Traits = Detail::MemberFunctionTraits<decltype(PMF)>;
+
+            static_assert(std::is_same_v<typename Traits::Class, ClassT>, "member function belongs to a different class");
+
+            MethodDesc m;
+
+            m.name = SimpleNameOf(qualifiedName);
+            m.qualifiedName = qualifiedName;
+            m.returnType = QualOf<typename Traits::Return>();
+            m.parameters = Traits::template Apply<Params>::Get();
+            m.access = A;
+            m.qualifiers = Q;
+            m.isVirtual = isVirtual;
+            m.isStatic = isStatic;
+            m.isDeleted = false;
+            m.isDefaulted = false;
+            m.isPureVirtual = false;
+            TypeHierarchy::SetCallers<PMF>(m);
+
+            return m;
+        }
+
+        template <Access A, Qualifiers Q, typename R, typename... Args>
+        static consteval auto MethodPureVirtual(std::string_view qualifiedName) -> MethodDesc
+        {
+            MethodDesc m;
+
+            m.name = SimpleNameOf(qualifiedName);
+            m.qualifiedName = qualifiedName;
+            m.returnType = QualOf<R>();
+            m.parameters = Params<Args...>::Get();
+            m.access = A;
+            m.qualifiers = Q;
+            m.isVirtual = true;
+            m.isStatic = false;
+            m.isDeleted = false;
+            m.isDefaulted = false;
+            m.isPureVirtual = true;
+            m.erasedCaller = nullptr;
+
+            return m;
+        }
+
+        template <Access A, Qualifiers Q>
+        static consteval auto MethodTemplated(std::string_view qualifiedName, size_t templateArity = 1) -> TemplatedMethodDesc
+        {
+            TemplatedMethodDesc t;
+
+            t.name = SimpleNameOf(qualifiedName);
+            t.qualifiedName = qualifiedName;
+            t.access = A;
+            t.qualifiers = Q;
+            t.templateDisplay = TemplateDisplayOf(templateArity);
+            t.templateArity = templateArity;
+            t.erasedTemplatedCaller = nullptr;
+            t.binderTag = nullptr;
+
+            return t;
+        }
+
+        template <Access A, bool Explicit, typename... Args>
+        static consteval auto Ctor(std::string_view typeQualifiedName) -> CtorDesc
+        {
+            CtorDesc c;
+
+            c.qualifiedName = typeQualifiedName;
+            c.parameters = Params<Args...>::Get();
+            c.access = A;
+            c.isExplicit = Explicit;
+
+            if constexpr (!std::is_abstract_v<ClassT> && std::is_constructible_v<ClassT, Args...>)
+            {
+                c.erasedCtor = &TypeHierarchy::CallCtor<ClassT, Args...>;
+                c.erasedArrayCtor = &TypeHierarchy::CallCtorArray<ClassT, Args...>;
+            }
+            else
+                c.erasedCtor = nullptr;
+
+            return c;
+        }
+
+        template <Access A>
+        static consteval auto Dtor(std::string_view typeQualifiedName) -> DtorDesc
+        {
+            DtorDesc d;
+
+            d.qualifiedName = typeQualifiedName;
+            d.access = A;
+            d.isVirtual = std::has_virtual_destructor_v<ClassT>;
+            d.isNoexcept = std::is_nothrow_destructible_v<ClassT>;
+            d.erasedDtor = &TypeHierarchy::CallDtor<ClassT>;
+            d.erasedArrayDtor = &TypeHierarchy::CallDtorArray<ClassT>;
+
+            return d;
+        }
+
+    private:
+
+        template <typename T>
+        static consteval auto QualOf() -> QualTypeInfo
+        {
+            constexpr std::string_view name = Detail::StaticTypeName<T>::value;
+
+            if constexpr (std::is_same_v<T, void>)
+                return QualTypeInfo{ name, name, 0, 0, std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T>, &typeid(T) };
+            else
+                return QualTypeInfo{ name, name, sizeof(T), alignof(T), std::is_const_v<T>, std::is_volatile_v<T>, std::is_reference_v<T>, std::is_pointer_v<T>, &typeid(T) };
+        }
+
+        template <typename... A>
+        struct ParamStorage
+        {
+            static constexpr MethodParam value[] = { MethodParam{ std::string_view(), QualOf<A>() }... };
+        };
+
+        template <typename... A>
+        struct Params
+        {
+            static consteval auto Get() -> std::span<const MethodParam>
+            {
+                if constexpr (sizeof...(A) == 0)
+                    return {};
+                else
+                    return ParamStorage<A...>::value;
+            }
+        };
+
     };
 
+    template <typename T>
+    auto RegisterReflected(HashedName qualifiedName) -> bool
+    {
+#if defined(REFLECT_META_LAZY_REGISTRATION)
+        return Registry::Instance().RegisterLazy(qualifiedName, &typeid(T), +[]() -> TypeDesc { return Reflect<T>{}.Get(); });
+#else
+        const TypeDesc* t = Registry::Instance().Register(Reflect<T>{}.Get());
+
+        if (t == nullptr || t->qualifiedName != qualifiedName.name)
+            return false;
+
+        Registry::Instance().MapType<T>(t->id);
+
+        return true;
+#endif
+    }
+
 }
\ No newline at end of file
@@ -1,19 +1,27 @@
 ﻿#pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
 #include <string_view>
 #include <string>
 #include <vector>
+#include <span>
+#include <memory>
 #include <typeindex>
 #include <type_traits>
 #include <unordered_map>
+#include <deque>
 #include <optional>
 #include <utility>
 #include <tuple>
+#include <algorithm>
+#include <ranges>
+#include <iterator>
 #include <cassert>
 #include <new>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #define REFLECT_META_USED
@@ -63,17 +71,20 @@ namespace ReflectMeta
 
     enum class TypenameType : uint8_t { DEFAULT, CONCEPT, CUSTOM };
 
+    template <size_t N>
     struct FixedString
     {
-        const char* data;
-        size_t size;
+        char data[N];
 
-        template <size_t N>
-        consteval FixedString(const char(&arr)[N]) : data(arr), size(N - 1) { }
+        consteval FixedString(const char(&arr)[N])
+        {
+            for (size_t i = 0; i < N; ++i)
+                data[i] = arr[i];
+        }
 
         constexpr auto View() const noexcept -> std::string_view
         {
-            return std::string_view(data, size);
+            return std::string_view(data, N - 1);
         }
     };
 
@@ -82,639 +93,3097 @@ namespace ReflectMeta
         uint64_t hi;
         uint64_t lo;
 
-        auto operator==(const TypeId& rhs) const -> bool { return hi == rhs.hi && lo == rhs.lo; }
+        constexpr auto operator==(const TypeId& rhs) const -> bool { return hi == rhs.hi && lo == rhs.lo; }
 
         struct Hash
         {
             auto operator()(const TypeId& k) const -> size_t
             {
-                return static_cast<size_t>(k.hi ^ (k.lo << 1));
+                return static_cast<size_t>(k.lo ^ (k.hi >> 32));
             }
         };
     };
 
-    struct QualTypeInfo
+    constexpr auto Mix64(uint64_t h) noexcept -> uint64_t
     {
-        std::string_view displayName;
-        std::string_view qualifiedName;
-
-        size_t sizeInBytes;
-        size_t alignInBytes;
+        h ^= h >> 30;
+        h *= 0xBF58476D1CE4E5B9ull;
+        h ^= h >> 27;
+        h *= 0x94D049BB133111EBull;
 
-        bool isConst;
-        bool isVolatile;
-        bool isReference;
-        bool isPointer;
-    };
+        return h ^ (h >> 31);
+    }
 
-    struct FieldDesc
+    constexpr auto HashString(std::string_view s) noexcept -> uint64_t
     {
-        std::string_view name;
-        QualTypeInfo type;
-        size_t offsetInBytes;
+        uint64_t h = 1469598103934665603ull;
 
-        bool isBitField;
+        for (char c : s)
+        {
+            h ^= static_cast<uint8_t>(c);
+            h *= 1099511628211ull;
+        }
 
-        uint32_t bitWidth;
-        Access access;
-    };
+        return h;
+    }
 
-    struct MethodParam
+    constexpr auto TypeIdOf(std::string_view qualifiedName) noexcept -> TypeId
     {
-        std::string_view name;
-        QualTypeInfo type;
-    };
+        constexpr uint64_t primeLow = 0x13Bull;
 
-    struct MethodDesc
-    {
-        std::string_view name;
-        std::string_view qualifiedName;
+        uint64_t hi = 0x6C62272E07BB0142ull;
+        uint64_t lo = 0x62B821756295C58Dull;
 
-        QualTypeInfo returnType;
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 h = (static_cast<unsigned __int128>(hi) << 64) | lo;
+        const unsigned __int128 prime = (static_cast<unsigned __int128>(1) << 88) | primeLow;
 
-        std::vector<MethodParam> parameters;
+        for (char c : qualifiedName)
+            h = (h ^ static_cast<uint8_t>(c)) * prime;
 
-        Access access;
-        Qualifiers qualifiers;
+        hi = static_cast<uint64_t>(h >> 64);
+        lo = static_cast<uint64_t>(h);
+#else
+        for (char c : qualifiedName)
+        {
+            lo ^= static_cast<uint8_t>(c);
 
-        bool isVirtual;
-        bool isStatic;
-        bool isDeleted;
-        bool isDefaulted;
-        void* erasedCaller;
+            const uint64_t carry = ((lo >> 32) * primeLow + (((lo & 0xFFFFFFFFull) * primeLow) >> 32)) >> 32;
 
-        bool isPureVirtual;
-    };
+            hi = hi * primeLow + carry + (lo << 24);
+            lo = lo * primeLow;
+        }
+#endif
 
-    struct TemplatedMethodDesc
+        // FNV-1a 128 only diffuses the last bytes into a few bits; mixing each half is a bijection, so it keeps all 128 bits distinct.
+        return TypeId{ Mix64(hi), Mix64(lo) };
+    }
+
+    struct HashedName
     {
         std::string_view name;
-        std::string_view qualifiedName;
+        TypeId id;
 
-        Access access;
-        Qualifiers qualifiers;
+        template <size_t N>
+        consteval HashedName(const char (&literal)[N]) : name(literal, N - 1), id(TypeIdOf(name)) { }
 
-        std::string_view templateDisplay;
+        HashedName(std::string_view name) : name(name), id(TypeIdOf(name)) { }
 
-        void* erasedTemplatedCaller;
-        void* binderTag;
+        HashedName(const std::string& name) : HashedName(std::string_view(name)) { }
     };
 
-    struct BaseDesc
+    constexpr auto TemplateDisplayOf(size_t templateArity) noexcept -> std::string_view
     {
-        using AdjustPtr = void* (*)(void*) noexcept;
-        using AdjustConstPtr = const void* (*)(const void*) noexcept;
-
-        TypeId baseTypeId;
-        size_t offsetInBytes;
+        constexpr std::string_view displays[] = { "<>", "<typename T>", "<typename T0, typename T1>", "<typename T0, typename T1, typename T2>", "<typename T0, typename T1, typename T2, typename T3>" };
 
-        bool isVirtual;
+        return templateArity < std::size(displays) ? displays[templateArity] : "<typename... T>";
+    }
 
-        Access access;
+    constexpr auto SimpleNameOf(std::string_view qualifiedName) noexcept -> std::string_view
+    {
+        const size_t p = qualifiedName.rfind("::");
 
-        AdjustPtr adjustPtr;
-        AdjustConstPtr adjustConstPtr;
-    };
+        return p == std::string_view::npos ? qualifiedName : qualifiedName.substr(p + 2);
+    }
 
-    struct CtorDesc
+    class DescriptorArena
     {
-        std::string_view qualifiedName;
-        std::vector<MethodParam> parameters;
-        Access access;
-        bool isExplicit;
 
-        using Erased = void (*)(void* storage, void** args) noexcept;
-        Erased erasedCtor;
-    };
+    public:
 
-    struct DtorDesc
-    {
-        std::string_view qualifiedName;
-        Access access;
-        bool isVirtual;
-        bool isNoexcept;
+        enum class Region : uint8_t
+        {
+            HOT,
+            COLD
+        };
 
-        using Erased = void (*)(void* obj) noexcept;
-        Erased erasedDtor;
-    };
+        static constexpr size_t BLOCK_SIZE = 64 * 1024;
 
-    struct TypeDesc
-    {
-        TypeId id;
+        static auto Module() -> DescriptorArena&
+        {
+            static DescriptorArena arena;
 
-        std::string_view name;
-        std::string_view qualifiedName;
+            return arena;
+        }
 
-        size_t sizeInBytes;
-        size_t alignInBytes;
+        template <typename T>
+        auto Allocate(size_t count, Region region = Region::HOT) -> std::span<T>
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "arena storage is never destroyed");
 
-        bool isClass;
-        bool isStruct;
-        bool isUnion;
-        bool isEnum;
-        bool isPolymorphic;
+            if (count == 0)
+                return {};
 
-        std::vector<FieldDesc> fields;
-        std::vector<MethodDesc> methods;
-        std::vector<TemplatedMethodDesc> templatedMethods;
-        std::vector<BaseDesc> bases;
+            T* p = static_cast<T*>(AllocateBytes(sizeof(T) * count, alignof(T), region));
 
-        std::vector<CtorDesc> constructors;
-        std::optional<DtorDesc> destructor;
-    };
+            return std::span<T>(std::uninitialized_value_construct_n(p, count) - count, count);
+        }
 
-    template <typename MemberT>
-    class MemberTypeTyped
-    {
+        template <typename T>
+        auto Copy(std::span<const T> source, Region region = Region::HOT) -> std::span<const T>
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "arena storage is never destroyed");
 
-    public:
+            if (source.empty())
+                return {};
 
-        using ValueType = MemberT;
+            T* p = static_cast<T*>(AllocateBytes(sizeof(T) * source.size(), alignof(T), region));
 
-        MemberTypeTyped(std::string_view qualifiedMemberName, size_t offsetInBytes) : qualifiedMemberName(qualifiedMemberName), offsetInBytes(offsetInBytes) {}
+            std::uninitialized_copy(source.begin(), source.end(), p);
 
-        auto GetQualifiedName() const noexcept -> std::string_view
-        {
-            return qualifiedMemberName;
+            return std::span<const T>(p, source.size());
         }
 
-        auto Get(void* object) const noexcept -> MemberT&
+        template <typename T>
+        auto Copy(const std::vector<T>& source, Region region = Region::HOT) -> std::span<const T>
         {
-            return *reinterpret_cast<MemberT*>(reinterpret_cast<char*>(object) + offsetInBytes);
+            return Copy(std::span<const T>(source), region);
         }
 
-        auto Get(const void* object) const noexcept -> const MemberT&
+        auto BytesUsed() const -> size_t
         {
-            return *reinterpret_cast<const MemberT*>(reinterpret_cast<const char*>(object) + offsetInBytes);
+            std::lock_guard lock(mutex);
+
+            size_t used = 0;
+
+            for (const std::vector<Block>& blocks : regions)
+            {
+                for (const Block& b : blocks)
+                    used += b.used;
+            }
+
+            return used;
         }
 
-        auto Assign(const MemberT& value, void* object) const noexcept -> void
+        auto BytesReserved() const -> size_t
         {
-            *reinterpret_cast<MemberT*>(reinterpret_cast<char*>(object) + offsetInBytes) = value;
+            std::lock_guard lock(mutex);
+
+            size_t reserved = 0;
+
+            for (const std::vector<Block>& blocks : regions)
+            {
+                for (const Block& b : blocks)
+                    reserved += b.size;
+            }
+
+            return reserved;
         }
 
     private:
 
-        std::string_view qualifiedMemberName;
-        size_t offsetInBytes;
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> memory;
+            size_t size;
+            size_t used;
+        };
+
+        auto AllocateBytes(size_t size, size_t align, Region region) -> void*
+        {
+            std::lock_guard lock(mutex);
+
+            std::vector<Block>& blocks = regions[static_cast<size_t>(region)];
+
+            if (!blocks.empty())
+            {
+                Block& b = blocks.back();
+                const uintptr_t base = reinterpret_cast<uintptr_t>(b.memory.get());
+                const uintptr_t aligned = (base + b.used + align - 1) & ~(static_cast<uintptr_t>(align) - 1);
+
+                if (aligned + size <= base + b.size)
+                {
+                    b.used = aligned + size - base;
+
+                    return reinterpret_cast<void*>(aligned);
+                }
+            }
+
+            const size_t blockSize = size + align > BLOCK_SIZE ? size + align : BLOCK_SIZE;
+            Block& b = blocks.emplace_back(Block{ std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize, 0 });
+            const uintptr_t base = reinterpret_cast<uintptr_t>(b.memory.get());
+            const uintptr_t aligned = (base + align - 1) & ~(static_cast<uintptr_t>(align) - 1);
+
+            b.used = aligned + size - base;
+
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        std::vector<Block> regions[2];
+        mutable std::mutex mutex;
     };
 
-    class MemberTypeErased
+    class ObjectPool
     {
 
     public:
 
-        MemberTypeErased(std::string_view qualifiedMemberName, QualTypeInfo typeInfo, size_t offsetInBytes) : qualifiedMemberName(qualifiedMemberName), typeInfo(typeInfo), offsetInBytes(offsetInBytes) {}
+        static constexpr size_t PAGE_SIZE = 64 * 1024;
+        static constexpr uint32_t MAGAZINE_CAPACITY = 32;
 
-        auto GetQualifiedName() const noexcept -> std::string_view
+        struct Stats
         {
-            return qualifiedMemberName;
-        }
+            size_t slotSize;
+            size_t pages;
+            size_t capacity;
+            size_t outstanding;
+        };
 
-        auto GetType() const noexcept -> const QualTypeInfo&
+        ObjectPool(size_t sizeInBytes, size_t alignInBytes) : slotAlign(std::max(alignInBytes, alignof(FreeNode))), slotSize(RoundUp(std::max(sizeInBytes, sizeof(FreeNode)), slotAlign)), pageSize(std::max(PAGE_SIZE, slotSize * MAGAZINE_CAPACITY)), id(NextId()) {}
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        ~ObjectPool()
         {
-            return typeInfo;
+            for (void* page : pages)
+                ::operator delete(page, std::align_val_t(slotAlign));
         }
 
-        template <typename T>
-        auto AsTyped() const -> std::optional<MemberTypeTyped<T>>
+        auto Allocate() -> void*
         {
-            if (typeInfo.sizeInBytes != sizeof(T))
-                return std::nullopt;
+            Magazine& m = LocalMagazine();
 
-            return MemberTypeTyped<T>(qualifiedMemberName, offsetInBytes);
+            if (m.count == 0)
+                Refill(m);
+
+            return m.items[--m.count];
         }
 
-        auto GetAny(void* object, void* outValueBuffer) const noexcept -> void
+        auto Deallocate(void* p) -> void
         {
-            std::memcpy(outValueBuffer, reinterpret_cast<char*>(object) + offsetInBytes, typeInfo.sizeInBytes);
+            Magazine& m = LocalMagazine();
+
+            if (m.count == MAGAZINE_CAPACITY)
+                Drain(m, MAGAZINE_CAPACITY / 2);
+
+            m.items[m.count++] = p;
         }
 
-        auto AssignAny(void* object, const void* inValueBuffer) const noexcept -> void
+        auto GetStats() const -> Stats
         {
-            std::memcpy(reinterpret_cast<char*>(object) + offsetInBytes, inValueBuffer, typeInfo.sizeInBytes);
+            std::lock_guard lock(mutex);
+
+            return Stats{ slotSize, pages.size(), pages.size() * (pageSize / slotSize), outstanding };
         }
 
     private:
 
-        std::string_view qualifiedMemberName;
-        QualTypeInfo typeInfo;
-        size_t offsetInBytes;
-    };
-
-
-    template <typename R, typename ClassT, typename... Args>
-    class MethodTypeTyped
-    {
+        struct FreeNode
+        {
+            FreeNode* next;
+        };
 
-    public:
+        struct Magazine
+        {
+            ObjectPool* owner = nullptr;
+            uint32_t count = 0;
+            void* items[MAGAZINE_CAPACITY];
+        };
 
-        using Caller = R(*)(ClassT&, Args&&...) noexcept;
+        struct MagazineSet
+        {
+            std::vector<Magazine> magazines;
 
-        MethodTypeTyped(std::string_view qualifiedName, Caller caller) : qualifiedName(qualifiedName), caller(caller) { }
+            ~MagazineSet()
+            {
+                for (Magazine& m : magazines)
+                {
+                    if (m.owner != nullptr && m.count != 0)
+                        m.owner->Drain(m, m.count);
+                }
+            }
+        };
 
-        auto Invoke(ClassT& self, Args... args) const noexcept -> R
+        static constexpr auto RoundUp(size_t n, size_t align) noexcept -> size_t
         {
-            return caller(self, static_cast<Args&&>(args)...);
+            return (n + align - 1) & ~(align - 1);
         }
 
-        auto GetQualifiedName() const noexcept -> std::string_view
+        static auto NextId() -> size_t
         {
-            return qualifiedName;
-        }
+            static std::atomic<size_t> next = 0;
 
-    private:
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
 
-        std::string_view qualifiedName;
-        Caller caller;
-    };
+        auto LocalMagazine() -> Magazine&
+        {
+            thread_local MagazineSet set;
 
-    class MethodTypeErased
-    {
+            if (id >= set.magazines.size())
+                set.magazines.resize(id + 1);
 
-    public:
+            Magazine& m = set.magazines[id];
 
-        using Caller = void (*)(void*, void** args, void* retOut) noexcept;
+            m.owner = this;
 
-        MethodTypeErased(std::string_view qualifiedName, Caller caller) : qualifiedName(qualifiedName), caller(caller) { }
+            return m;
+        }
 
-        auto Invoke(void* self, void** args, void* retOut) const noexcept -> void 
+        auto Refill(Magazine& m) -> void
         {
-            caller(self, args, retOut);
+            std::lock_guard lock(mutex);
+
+            while (m.count < MAGAZINE_CAPACITY / 2)
+            {
+                if (freeList != nullptr)
+                {
+                    m.items[m.count++] = freeList;
+                    freeList = freeList->next;
+                    continue;
+                }
+
+                if (bumpCursor == bumpEnd)
+                {
+                    std::byte* page = static_cast<std::byte*>(::operator new(pageSize, std::align_val_t(slotAlign)));
+
+                    pages.push_back(page);
+                    bumpCursor = page;
+                    bumpEnd = page + (pageSize / slotSize) * slotSize;
+                }
+
+                m.items[m.count++] = bumpCursor;
+                bumpCursor += slotSize;
+            }
+
+            outstanding += MAGAZINE_CAPACITY / 2;
         }
 
-        auto GetQualifiedName() const noexcept -> std::string_view
+        auto Drain(Magazine& m, uint32_t n) -> void
         {
-            return qualifiedName;
+            std::lock_guard lock(mutex);
+
+            for (uint32_t i = 0; i < n; ++i)
+            {
+                FreeNode* node = static_cast<FreeNode*>(m.items[--m.count]);
+
+                node->next = freeList;
+                freeList = node;
+            }
+
+            outstanding -= n;
         }
-    
-    private:
-    
-        std::string_view qualifiedName;
-        Caller caller;
+
+        const size_t slotAlign;
+        const size_t slotSize;
+        const size_t pageSize;
+        const size_t id;
+
+        mutable std::mutex mutex;
+        std::vector<void*> pages;
+        FreeNode* freeList = nullptr;
+        std::byte* bumpCursor = nullptr;
+        std::byte* bumpEnd = nullptr;
+        size_t outstanding = 0;
     };
 
-    template <typename Binder, typename ClassT>
-    class MethodTypeTemplatedTyped
+    class NameIndex
     {
 
     public:
 
-        MethodTypeTemplatedTyped(std::string_view qualifiedName) : qualifiedName(qualifiedName) { }
-        
-        template <typename T, typename... A>
-        auto Invoke(ClassT& self, A&&... a) const noexcept -> decltype(auto)
+        static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+        struct Slot
         {
-            return Binder::template Call<T>(self, static_cast<A&&>(a)...);
+            std::string_view key;
+            uint64_t hash = 0;
+            uint32_t firstAny = NOT_FOUND;
+            uint32_t firstPublic = NOT_FOUND;
+        };
+
+        auto Reserve(size_t keyCount) -> void
+        {
+            slots = DescriptorArena::Module().Allocate<Slot>(CapacityFor(keyCount));
         }
-        
-        auto GetQualifiedName() const noexcept -> std::string_view
+
+        auto Reserve(size_t keyCount, std::vector<Slot>& storage) -> void
         {
-            return qualifiedName;
+            storage.assign(CapacityFor(keyCount), Slot{});
+            slots = storage;
         }
-    
-    private:
-        
+
+        auto Insert(std::string_view key, uint32_t index, Access access) -> void
+        {
+            const uint64_t h = HashString(key);
+            const size_t mask = slots.size() - 1;
+
+            for (size_t i = static_cast<size_t>(h) & mask;; i = (i + 1) & mask)
+            {
+                Slot& s = slots[i];
+
+                if (s.firstAny == NOT_FOUND)
+                {
+                    s.key = key;
+                    s.hash = h;
+                    s.firstAny = index;
+                    s.firstPublic = access == Access::PUBLIC ? index : NOT_FOUND;
+
+                    return;
+                }
+
+                if (s.hash == h && s.key == key)
+                {
+                    if (s.firstPublic == NOT_FOUND && access == Access::PUBLIC)
+                        s.firstPublic = index;
+
+                    return;
+                }
+            }
+        }
+
+        auto Find(std::string_view key, bool accessibilityConsidered) const noexcept -> uint32_t
+        {
+            if (slots.empty())
+                return NOT_FOUND;
+
+            const uint64_t h = HashString(key);
+            const size_t mask = slots.size() - 1;
+
+            for (size_t i = static_cast<size_t>(h) & mask;; i = (i + 1) & mask)
+            {
+                const Slot& s = slots[i];
+
+                if (s.firstAny == NOT_FOUND)
+                    return NOT_FOUND;
+
+                if (s.hash == h && s.key == key)
+                    return accessibilityConsidered ? s.firstPublic : s.firstAny;
+            }
+        }
+
+    private:
+
+        static auto CapacityFor(size_t keyCount) noexcept -> size_t
+        {
+            size_t capacity = 4;
+
+            while (capacity * 3 < keyCount * 4)
+                capacity <<= 1;
+
+            return capacity;
+        }
+
+        std::span<Slot> slots;
+    };
+
+    class SignatureIndex
+    {
+
+    public:
+
+        static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+        auto Reserve(size_t keyCount) -> void
+        {
+            size_t capacity = 4;
+
+            while (capacity * 3 < keyCount * 4)
+                capacity <<= 1;
+
+            slots = DescriptorArena::Module().Allocate<Slot>(capacity);
+        }
+
+        auto Insert(size_t argc, uint64_t hash, uint32_t index) -> void
+        {
+            const size_t mask = slots.size() - 1;
+
+            for (size_t i = static_cast<size_t>(hash ^ argc) & mask;; i = (i + 1) & mask)
+            {
+                Slot& s = slots[i];
+
+                if (s.index == NOT_FOUND)
+                {
+                    s.hash = hash;
+                    s.argc = static_cast<uint32_t>(argc);
+                    s.index = index;
+
+                    return;
+                }
+            }
+        }
+
+        template <typename Accept>
+        auto Find(size_t argc, uint64_t hash, Accept&& accept) const noexcept -> uint32_t
+        {
+            if (slots.empty())
+                return NOT_FOUND;
+
+            const size_t mask = slots.size() - 1;
+
+            for (size_t i = static_cast<size_t>(hash ^ argc) & mask;; i = (i + 1) & mask)
+            {
+                const Slot& s = slots[i];
+
+                if (s.index == NOT_FOUND)
+                    return NOT_FOUND;
+
+                if (s.hash == hash && s.argc == argc && accept(s.index))
+                    return s.index;
+            }
+        }
+
+    private:
+
+        struct Slot
+        {
+            uint64_t hash = 0;
+            uint32_t argc = 0;
+            uint32_t index = NOT_FOUND;
+        };
+
+        std::span<Slot> slots;
+    };
+
+    struct TypeNameIndex
+    {
+        NameIndex fields;
+        NameIndex methods;
+        NameIndex templatedMethods;
+        SignatureIndex constructors;
+
+        bool built = false;
+    };
+
+    struct QualTypeInfo
+    {
+        std::string_view displayName;
+        std::string_view qualifiedName;
+
+        size_t sizeInBytes;
+        size_t alignInBytes;
+
+        bool isConst;
+        bool isVolatile;
+        bool isReference;
+        bool isPointer;
+
+        const std::type_info* typeInfo = nullptr;
+    };
+
+    inline auto MatchesType(const QualTypeInfo& q, const std::type_info& ti) noexcept -> bool
+    {
+        if (q.typeInfo != nullptr)
+            return *q.typeInfo == ti;
+
+        return q.qualifiedName == std::string_view(ti.name());
+    }
+
+    inline auto CombineSignatureHash(uint64_t h, const std::type_info* parameterType) noexcept -> uint64_t
+    {
+        h ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(parameterType));
+        h *= 0x9E3779B97F4A7C15ull;
+
+        return h ^ (h >> 29);
+    }
+
+    inline auto CombineSignatureHash(uint64_t h, std::string_view parameterTypeName) noexcept -> uint64_t
+    {
+        h ^= HashString(parameterTypeName);
+        h *= 0x9E3779B97F4A7C15ull;
+
+        return h ^ (h >> 29);
+    }
+
+    inline auto SignatureNameOf(const QualTypeInfo& q) noexcept -> std::string_view
+    {
+        return q.typeInfo != nullptr ? std::string_view(q.typeInfo->name()) : q.qualifiedName;
+    }
+
+    inline auto SignatureHashOf(size_t argc, const std::type_info* const* argTypes) noexcept -> uint64_t
+    {
+        uint64_t h = argc;
+
+        for (size_t i = 0; i < argc; ++i)
+            h = CombineSignatureHash(h, argTypes[i]);
+
+        return h;
+    }
+
+    inline auto SignatureNameHashOf(size_t argc, const std::type_info* const* argTypes) noexcept -> uint64_t
+    {
+        uint64_t h = ~static_cast<uint64_t>(argc);
+
+        for (size_t i = 0; i < argc; ++i)
+            h = CombineSignatureHash(h, std::string_view(argTypes[i]->name()));
+
+        return h;
+    }
+
+    struct FieldDesc
+    {
+        std::string_view name;
+        QualTypeInfo type;
+        size_t offsetInBytes;
+
+        bool isBitField;
+
+        uint32_t bitWidth;
+        Access access;
+    };
+
+    struct MethodParam
+    {
+        std::string_view name;
+        QualTypeInfo type;
+    };
+
+    struct BatchInvocation
+    {
+        void* const* objects;
+        std::byte* objectBase;
+        size_t objectStride;
+        size_t count;
+
+        void** args;
+        const size_t* argStrides;
+
+        std::byte* retOut;
+        size_t retStride;
+    };
+
+    template <typename R, typename ClassT, typename... Args>
+    using TypedMethodCaller = R(*)(ClassT&, Args...) noexcept;
+
+    namespace Detail
+    {
+        template <typename Caller>
+        struct TypedCallerHolder
+        {
+            Caller call;
+        };
+    }
+
+    struct MethodDesc
+    {
+        std::string_view name;
+        std::string_view qualifiedName;
+
+        QualTypeInfo returnType;
+
+        std::span<const MethodParam> parameters;
+
+        Access access;
+        Qualifiers qualifiers;
+
+        bool isVirtual;
+        bool isStatic;
+        bool isDeleted;
+        bool isDefaulted;
+
+        using ErasedCaller = void (*)(void* self, void** args, void* retOut) noexcept;
+        ErasedCaller erasedCaller;
+
+        const void* typedCaller = nullptr;
+        const std::type_info* typedSignature = nullptr;
+
+        using BatchCaller = void (*)(const BatchInvocation& batch) noexcept;
+        BatchCaller batchCaller = nullptr;
+
+        using EmplaceCaller = void (*)(void* self, void** args, void* retStorage) noexcept;
+        EmplaceCaller emplaceCaller = nullptr;
+
+        bool isPureVirtual;
+    };
+
+    struct TemplatedSpecialization
+    {
+        std::span<const std::type_info* const> typeArgs;
+        MethodDesc::ErasedCaller caller;
+    };
+
+    struct TemplatedMethodDesc
+    {
+        std::string_view name;
         std::string_view qualifiedName;
+
+        Access access;
+        Qualifiers qualifiers;
+
+        std::string_view templateDisplay;
+        size_t templateArity = 1;
+
+        void* erasedTemplatedCaller;
+        void* binderTag;
+
+        std::span<const TemplatedSpecialization> specializations = {};
+    };
+
+    struct BaseDesc
+    {
+        using AdjustPtr = void* (*)(void*) noexcept;
+        using AdjustConstPtr = const void* (*)(const void*) noexcept;
+        using OffsetOf = size_t (*)() noexcept;
+
+        static constexpr size_t UNRESOLVED_OFFSET = static_cast<size_t>(-1);
+
+        TypeId baseTypeId;
+        size_t offsetInBytes;
+
+        bool isVirtual;
+
+        Access access;
+
+        AdjustPtr adjustPtr;
+        AdjustConstPtr adjustConstPtr;
+        OffsetOf offsetOf = nullptr;
+    };
+
+    struct AncestorDesc
+    {
+        TypeId typeId;
+        ptrdiff_t offsetInBytes;
+
+        const BaseDesc* virtualBase;
+    };
+
+    struct AncestorTable
+    {
+        struct Slot
+        {
+            uint32_t typeIndex = NO_ENTRY;
+            uint32_t entry = NO_ENTRY;
+        };
+
+        static constexpr uint32_t NO_ENTRY = 0xFFFFFFFFu;
+
+        std::span<const AncestorDesc> entries;
+        std::span<const uint64_t> closure;
+        std::span<const Slot> byTypeIndex;
+
+        auto FindByTypeIndex(uint32_t typeIndex) const noexcept -> const AncestorDesc*
+        {
+            if ((typeIndex >> 6) >= closure.size() || ((closure[typeIndex >> 6] >> (typeIndex & 63)) & 1) == 0 || byTypeIndex.empty())
+                return nullptr;
+
+            const size_t mask = byTypeIndex.size() - 1;
+
+            for (size_t i = typeIndex & mask;; i = (i + 1) & mask)
+            {
+                const Slot& s = byTypeIndex[i];
+
+                if (s.typeIndex == typeIndex)
+                    return &entries[s.entry];
+
+                if (s.typeIndex == NO_ENTRY)
+                    return nullptr;
+            }
+        }
+    };
+
+    struct InheritedField
+    {
+        const FieldDesc* field;
+        Access access;
+
+        ptrdiff_t offsetInBytes;
+
+        const BaseDesc* virtualBase;
+        const InheritedField* next;
+
+        bool isAmbiguous;
+    };
+
+    struct InheritedMethod
+    {
+        const MethodDesc* method;
+        Access access;
+
+        ptrdiff_t offsetInBytes;
+
+        const BaseDesc* virtualBase;
+        const InheritedMethod* next;
+
+        bool isAmbiguous;
+    };
+
+    struct InheritedView
+    {
+        std::span<const InheritedField> fields;
+        std::span<const InheritedMethod> methods;
+
+        NameIndex fieldIndex;
+        NameIndex methodIndex;
+    };
+
+    struct VirtualSlot
+    {
+        static constexpr uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+        TypeId root;
+        uint32_t index = NO_INDEX;
+
+        explicit operator bool() const noexcept
+        {
+            return index != NO_INDEX;
+        }
+
+        bool operator==(const VirtualSlot&) const noexcept = default;
     };
 
-    class MethodTypeTemplatedErased
-    {
+    struct VirtualTable
+    {
+        struct Segment
+        {
+            TypeId root;
+            uint32_t first;
+            uint32_t count;
+        };
+
+        std::span<const Segment> segments;
+        std::span<const InheritedMethod> slots;
+
+        auto IndexOf(VirtualSlot slot) const noexcept -> uint32_t
+        {
+            for (const Segment& s : segments)
+            {
+                if (s.root == slot.root)
+                    return slot.index < s.count ? s.first + slot.index : VirtualSlot::NO_INDEX;
+            }
+
+            return VirtualSlot::NO_INDEX;
+        }
+    };
+
+    namespace Detail
+    {
+        template <typename DerivedT, typename BaseT>
+        concept VirtualBaseOf = std::is_base_of_v<BaseT, DerivedT> && !requires(BaseT* base) { static_cast<DerivedT*>(base); };
+
+        template <typename DerivedT, typename BaseT>
+        auto BaseOffsetOf() noexcept -> size_t
+        {
+            static_assert(!VirtualBaseOf<DerivedT, BaseT>, "a virtual base has no fixed offset");
+
+            alignas(DerivedT) std::byte storage[sizeof(DerivedT)];
+            const BaseT* base = reinterpret_cast<const DerivedT*>(storage);
+
+            return static_cast<size_t>(reinterpret_cast<const std::byte*>(base) - storage);
+        }
+
+        template <typename ClassT, typename MemberT>
+        auto MemberOffsetOf(MemberT ClassT::* member) -> size_t
+        {
+            static const ClassT probe{};
+
+            return static_cast<size_t>(reinterpret_cast<const std::byte*>(&(probe.*member)) - reinterpret_cast<const std::byte*>(&probe));
+        }
+
+        inline auto MemberOf(const InheritedField& e) noexcept -> const FieldDesc*
+        {
+            return e.field;
+        }
+
+        inline auto MemberOf(const InheritedMethod& e) noexcept -> const MethodDesc*
+        {
+            return e.method;
+        }
+
+        inline auto QualifiedNameOf(const FieldDesc& f) noexcept -> std::string_view
+        {
+            return f.name;
+        }
+
+        inline auto QualifiedNameOf(const MethodDesc& m) noexcept -> std::string_view
+        {
+            return m.qualifiedName;
+        }
+
+        template <typename Entry>
+        auto VirtualSubobjectOf(const Entry& e) noexcept -> const BaseDesc*
+        {
+            const BaseDesc* last = nullptr;
+
+            for (const Entry* p = &e; p != nullptr && p->virtualBase != nullptr; p = p->next)
+                last = p->virtualBase;
+
+            return last;
+        }
+
+        inline auto VirtualSignatureOf(const MethodDesc& m) noexcept -> uint64_t
+        {
+            uint64_t h = HashString(SimpleNameOf(m.name)) ^ m.parameters.size();
+
+            for (const MethodParam& p : m.parameters)
+                h = CombineSignatureHash(p.type.typeInfo != nullptr ? h : h ^ HashString(p.type.qualifiedName), p.type.typeInfo);
+
+            return HasQualifier(m.qualifiers, Qualifiers::CONST_) ? ~h : h;
+        }
+
+        template <typename Entry>
+        auto AdjustInherited(const Entry* e, void* obj) noexcept -> void*
+        {
+            std::byte* p = static_cast<std::byte*>(obj);
+
+            for (; e->virtualBase != nullptr; e = e->next)
+                p = static_cast<std::byte*>(e->virtualBase->adjustPtr(p + e->offsetInBytes));
+
+            return p + e->offsetInBytes;
+        }
+    }
+
+    struct CtorDesc
+    {
+        std::string_view qualifiedName;
+        std::span<const MethodParam> parameters;
+        Access access;
+        bool isExplicit;
+
+        using Erased = void (*)(void* storage, void** args) noexcept;
+        Erased erasedCtor;
+
+        using ErasedArray = void (*)(void* storage, size_t count, void** args) noexcept;
+        ErasedArray erasedArrayCtor = nullptr;
+    };
+
+    struct DtorDesc
+    {
+        std::string_view qualifiedName;
+        Access access;
+        bool isVirtual;
+        bool isNoexcept;
+
+        using Erased = void (*)(void* obj) noexcept;
+        Erased erasedDtor;
+
+        using ErasedArray = void (*)(void* obj, size_t count) noexcept;
+        ErasedArray erasedArrayDtor = nullptr;
+    };
+
+    struct ValueOps
+    {
+        using CopyConstruct = void (*)(void* dst, const void* src, size_t count) noexcept;
+        using MoveConstruct = void (*)(void* dst, void* src, size_t count) noexcept;
+        using CopyAssign = void (*)(void* dst, const void* src, size_t count) noexcept;
+        using MoveAssign = void (*)(void* dst, void* src, size_t count) noexcept;
+        using Relocate = void (*)(void* dst, void* src, size_t count) noexcept;
+
+        CopyConstruct copyConstruct = nullptr;
+        MoveConstruct moveConstruct = nullptr;
+        CopyAssign copyAssign = nullptr;
+        MoveAssign moveAssign = nullptr;
+        Relocate relocate = nullptr;
+    };
+
+    struct TypeDesc
+    {
+        static constexpr uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+        TypeId id;
+
+        std::string_view name;
+        std::string_view qualifiedName;
+
+        size_t sizeInBytes;
+        size_t alignInBytes;
+
+        const std::type_info* typeInfo = nullptr;
+
+        bool isClass;
+        bool isStruct;
+        bool isUnion;
+        bool isEnum;
+        bool isPolymorphic;
+        bool isPooled = false;
+
+        bool isTriviallyCopyable = false;
+        bool isTriviallyDestructible = false;
+        bool isTriviallyRelocatable = false;
+
+        ValueOps valueOps;
+
+        const AncestorTable* ancestors = nullptr;
+        const InheritedView* inherited = nullptr;
+        const VirtualTable* virtuals = nullptr;
+        uint32_t typeIndex = NO_INDEX;
+
+        ObjectPool* pool = nullptr;
+
+        std::span<const FieldDesc> fields;
+        std::span<const MethodDesc> methods;
+        std::span<const TemplatedMethodDesc> templatedMethods;
+        std::span<const BaseDesc> bases;
+
+        std::span<const CtorDesc> constructors;
+        std::optional<DtorDesc> destructor;
+
+        TypeNameIndex nameIndex;
+    };
+
+    namespace Detail
+    {
+        inline auto MatchName(bool accessibilityConsidered, Access memberAccess, std::string_view stored, std::string_view query) noexcept -> bool
+        {
+            if (accessibilityConsidered && memberAccess != Access::PUBLIC)
+                return false;
+
+            return stored == query || SimpleNameOf(stored) == query;
+        }
+
+        template <typename Desc>
+        auto LookupByName(std::span<const Desc> entries, const NameIndex& index, bool indexBuilt, bool accessibilityConsidered, std::string_view name) noexcept -> const Desc*
+        {
+            if (indexBuilt)
+            {
+                const uint32_t i = index.Find(name, accessibilityConsidered);
+
+                return i == NameIndex::NOT_FOUND ? nullptr : &entries[i];
+            }
+
+            for (const Desc& d : entries)
+            {
+                if (MatchName(accessibilityConsidered, d.access, d.name, name))
+                    return &d;
+            }
+
+            return nullptr;
+        }
+
+        template <typename Desc>
+        auto BuildNameIndex(std::span<const Desc> entries, NameIndex& index) -> void
+        {
+            if (entries.empty())
+                return;
+
+            index.Reserve(entries.size() * 3);
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(entries.size()); ++i)
+            {
+                const Desc& d = entries[i];
+
+                index.Insert(d.name, i, d.access);
+                index.Insert(SimpleNameOf(d.name), i, d.access);
+
+                if constexpr (requires { d.qualifiedName; })
+                    index.Insert(d.qualifiedName, i, d.access);
+            }
+        }
+    }
+
+    namespace Detail
+    {
+        inline auto BuildSignatureIndex(std::span<const CtorDesc> constructors, SignatureIndex& index) -> void
+        {
+            if (constructors.empty())
+                return;
+
+            index.Reserve(constructors.size() * 2);
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(constructors.size()); ++i)
+            {
+                const std::span<const MethodParam> parameters = constructors[i].parameters;
+                uint64_t h = parameters.size();
+                uint64_t byName = ~static_cast<uint64_t>(parameters.size());
+                bool hashable = true;
+
+                for (const MethodParam& p : parameters)
+                {
+                    hashable = hashable && p.type.typeInfo != nullptr;
+                    h = CombineSignatureHash(h, p.type.typeInfo);
+                    byName = CombineSignatureHash(byName, SignatureNameOf(p.type));
+                }
+
+                if (hashable)
+                    index.Insert(parameters.size(), h, i);
+
+                index.Insert(parameters.size(), byName, i);
+            }
+        }
+
+        inline auto MatchCtor(const CtorDesc& c, bool accessibilityConsidered, size_t argc, const std::type_info* const* argTypes) noexcept -> bool
+        {
+            if (!c.erasedCtor)
+                return false;
+
+            if (accessibilityConsidered && c.access != Access::PUBLIC)
+                return false;
+
+            if (c.parameters.size() != argc)
+                return false;
+
+            for (size_t i = 0; i < argc; ++i)
+            {
+                if (!MatchesType(c.parameters[i].type, *argTypes[i]))
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    inline auto BuildNameIndex(TypeDesc& t) -> void
+    {
+        Detail::BuildNameIndex<FieldDesc>(t.fields, t.nameIndex.fields);
+        Detail::BuildNameIndex<MethodDesc>(t.methods, t.nameIndex.methods);
+        Detail::BuildNameIndex<TemplatedMethodDesc>(t.templatedMethods, t.nameIndex.templatedMethods);
+        Detail::BuildSignatureIndex(t.constructors, t.nameIndex.constructors);
+
+        t.nameIndex.built = true;
+    }
+
+    inline auto FindField(const TypeDesc& t, bool accessibilityConsidered, std::string_view name) noexcept -> const FieldDesc*
+    {
+        return Detail::LookupByName<FieldDesc>(t.fields, t.nameIndex.fields, t.nameIndex.built, accessibilityConsidered, name);
+    }
+
+    inline auto FindMethod(const TypeDesc& t, bool accessibilityConsidered, std::string_view name) noexcept -> const MethodDesc*
+    {
+        return Detail::LookupByName<MethodDesc>(t.methods, t.nameIndex.methods, t.nameIndex.built, accessibilityConsidered, name);
+    }
+
+    inline auto FindTemplatedMethod(const TypeDesc& t, bool accessibilityConsidered, std::string_view name) noexcept -> const TemplatedMethodDesc*
+    {
+        return Detail::LookupByName<TemplatedMethodDesc>(t.templatedMethods, t.nameIndex.templatedMethods, t.nameIndex.built, accessibilityConsidered, name);
+    }
+
+    inline auto FindInheritedField(const InheritedView& v, bool accessibilityConsidered, std::string_view name) noexcept -> const InheritedField*
+    {
+        const uint32_t i = v.fieldIndex.Find(name, accessibilityConsidered);
+
+        return i == NameIndex::NOT_FOUND ? nullptr : &v.fields[i];
+    }
+
+    inline auto FindInheritedMethod(const InheritedView& v, bool accessibilityConsidered, std::string_view name) noexcept -> const InheritedMethod*
+    {
+        const uint32_t i = v.methodIndex.Find(name, accessibilityConsidered);
+
+        return i == NameIndex::NOT_FOUND ? nullptr : &v.methods[i];
+    }
+
+    inline auto FindCtor(const TypeDesc& t, bool accessibilityConsidered, size_t argc, const std::type_info* const* argTypes) noexcept -> const CtorDesc*
+    {
+        if (t.nameIndex.built)
+        {
+            auto accept = [&](uint32_t candidate) noexcept
+                {
+                    return Detail::MatchCtor(t.constructors[candidate], accessibilityConsidered, argc, argTypes);
+                };
+
+            uint32_t i = t.nameIndex.constructors.Find(argc, SignatureHashOf(argc, argTypes), accept);
+
+            // Every constructor is also keyed by parameter type names, which covers a type_info from another module or a name-only parameter.
+            if (i == SignatureIndex::NOT_FOUND)
+                i = t.nameIndex.constructors.Find(argc, SignatureNameHashOf(argc, argTypes), accept);
+
+            return i != SignatureIndex::NOT_FOUND ? &t.constructors[i] : nullptr;
+        }
+
+        for (const CtorDesc& c : t.constructors)
+        {
+            if (Detail::MatchCtor(c, accessibilityConsidered, argc, argTypes))
+                return &c;
+        }
+
+        return nullptr;
+    }
+
+    inline auto AllocateObject(const TypeDesc& t) -> void*
+    {
+        if (t.pool != nullptr)
+            return t.pool->Allocate();
+
+        return ::operator new(t.sizeInBytes, std::align_val_t(t.alignInBytes));
+    }
+
+    inline auto FreeObject(const TypeDesc& t, void* p) -> void
+    {
+        if (t.pool != nullptr)
+            t.pool->Deallocate(p);
+        else
+            ::operator delete(p, std::align_val_t(t.alignInBytes));
+    }
+
+    class CtorHandle
+    {
+
+    public:
+
+        CtorHandle() = default;
+
+        CtorHandle(const TypeDesc& type, const CtorDesc* ctor) noexcept : type(&type), desc(ctor), construct(ctor ? ctor->erasedCtor : nullptr) {}
+
+        explicit operator bool() const noexcept { return construct != nullptr; }
+
+        auto GetDesc() const noexcept -> const CtorDesc* { return desc; }
+
+        auto ConstructInto(void* storage, void** args) const noexcept -> void
+        {
+            assert(construct != nullptr && "constructor handle is empty");
+
+            construct(storage, args);
+        }
+
+        auto ConstructArray(void* storage, size_t count, void** args) const noexcept -> void
+        {
+            assert(construct != nullptr && "constructor handle is empty");
+
+            if (desc->erasedArrayCtor != nullptr)
+                desc->erasedArrayCtor(storage, count, args);
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                    construct(static_cast<std::byte*>(storage) + i * type->sizeInBytes, args);
+            }
+        }
+
+        auto New(void** args) const -> void*
+        {
+            assert(construct != nullptr && "constructor handle is empty");
+
+            void* mem = AllocateObject(*type);
+
+            construct(mem, args);
+
+            return mem;
+        }
+
+    private:
+
+        const TypeDesc* type = nullptr;
+        const CtorDesc* desc = nullptr;
+        CtorDesc::Erased construct = nullptr;
+    };
+
+    namespace Detail
+    {
+        template <typename... Args>
+        struct CtorArgTypes final
+        {
+            static constexpr const std::type_info* value[] = { &typeid(Args)..., nullptr };
+        };
+    }
+
+    template <typename MemberT>
+    class MemberTypeTyped
+    {
+
+    public:
+
+        using ValueType = MemberT;
+
+        MemberTypeTyped(std::string_view qualifiedMemberName, size_t offsetInBytes) : qualifiedMemberName(qualifiedMemberName), offsetInBytes(offsetInBytes) {}
+
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedMemberName;
+        }
+
+        auto Get(void* object) const noexcept -> MemberT&
+        {
+            return *reinterpret_cast<MemberT*>(reinterpret_cast<char*>(object) + offsetInBytes);
+        }
+
+        auto Get(const void* object) const noexcept -> const MemberT&
+        {
+            return *reinterpret_cast<const MemberT*>(reinterpret_cast<const char*>(object) + offsetInBytes);
+        }
+
+        auto Assign(const MemberT& value, void* object) const noexcept -> void
+        {
+            *reinterpret_cast<MemberT*>(reinterpret_cast<char*>(object) + offsetInBytes) = value;
+        }
+
+    private:
+
+        std::string_view qualifiedMemberName;
+        size_t offsetInBytes;
+    };
+
+    class MemberTypeErased
+    {
+
+    public:
+
+        MemberTypeErased(std::string_view qualifiedMemberName, QualTypeInfo typeInfo, size_t offsetInBytes, const InheritedField* virtualPath = nullptr) : qualifiedMemberName(qualifiedMemberName), typeInfo(typeInfo), offsetInBytes(offsetInBytes), virtualPath(virtualPath) {}
+
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedMemberName;
+        }
+
+        auto GetType() const noexcept -> const QualTypeInfo&
+        {
+            return typeInfo;
+        }
+
+        template <typename T>
+        auto AsTyped() const -> std::optional<MemberTypeTyped<T>>
+        {
+            if (typeInfo.sizeInBytes != sizeof(T) || virtualPath != nullptr)
+                return std::nullopt;
+
+            return MemberTypeTyped<T>(qualifiedMemberName, offsetInBytes);
+        }
+
+        auto GetAny(void* object, void* outValueBuffer) const noexcept -> void
+        {
+            std::memcpy(outValueBuffer, AddressIn(object), typeInfo.sizeInBytes);
+        }
+
+        auto AssignAny(void* object, const void* inValueBuffer) const noexcept -> void
+        {
+            std::memcpy(AddressIn(object), inValueBuffer, typeInfo.sizeInBytes);
+        }
+
+    private:
+
+        auto AddressIn(void* object) const noexcept -> void*
+        {
+            if (virtualPath != nullptr)
+                return Detail::AdjustInherited(virtualPath, object);
+
+            return reinterpret_cast<char*>(object) + offsetInBytes;
+        }
+
+        std::string_view qualifiedMemberName;
+        QualTypeInfo typeInfo;
+        size_t offsetInBytes;
+        const InheritedField* virtualPath;
+    };
+
+
+    template <typename R, typename ClassT, typename... Args>
+    class MethodTypeTyped
+    {
+
+    public:
+
+        using Caller = TypedMethodCaller<R, ClassT, Args...>;
+
+        MethodTypeTyped(std::string_view qualifiedName, Caller caller) : qualifiedName(qualifiedName), caller(caller) { }
+
+        auto Invoke(ClassT& self, Args... args) const noexcept -> R
+        {
+            return caller(self, static_cast<Args&&>(args)...);
+        }
+
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedName;
+        }
+
+    private:
+
+        std::string_view qualifiedName;
+        Caller caller;
+    };
+
+    class MethodTypeErased
+    {
+
+    public:
+
+        using Caller = MethodDesc::ErasedCaller;
+        using BatchCaller = MethodDesc::BatchCaller;
+
+        using EmplaceCaller = MethodDesc::EmplaceCaller;
+
+        MethodTypeErased(std::string_view qualifiedName, Caller caller, BatchCaller batchCaller = nullptr, EmplaceCaller emplaceCaller = nullptr) : qualifiedName(qualifiedName), caller(caller), batchCaller(batchCaller), emplaceCaller(emplaceCaller) { }
+
+        MethodTypeErased(const InheritedMethod& inherited) : MethodTypeErased(inherited.method->qualifiedName, inherited.method->erasedCaller, nullptr, inherited.method->emplaceCaller)
+        {
+            if (inherited.virtualBase != nullptr)
+                virtualPath = &inherited;
+            else
+                selfOffset = inherited.offsetInBytes;
+
+            if (virtualPath == nullptr && selfOffset == 0)
+                batchCaller = inherited.method->batchCaller;
+        }
+
+        auto Invoke(void* self, void** args, void* retOut) const noexcept -> void 
+        {
+            caller(AdjustSelf(self), args, retOut);
+        }
+
+        auto InvokeInto(void* self, void** args, void* retStorage) const noexcept -> void
+        {
+            assert(emplaceCaller != nullptr && "method has no emplace thunk");
+
+            emplaceCaller(AdjustSelf(self), args, retStorage);
+        }
+
+        auto InvokeBatch(std::span<void* const> objects, void** args, const size_t* argStrides, void* retOut, size_t retStride) const noexcept -> void
+        {
+            assert(batchCaller != nullptr && "method has no batch thunk");
+
+            batchCaller(BatchInvocation{ objects.data(), nullptr, 0, objects.size(), args, argStrides, static_cast<std::byte*>(retOut), retStride });
+        }
+
+        auto InvokeBatch(void* objectBase, size_t objectStride, size_t count, void** args, const size_t* argStrides, void* retOut, size_t retStride) const noexcept -> void
+        {
+            assert(batchCaller != nullptr && "method has no batch thunk");
+
+            batchCaller(BatchInvocation{ nullptr, static_cast<std::byte*>(objectBase), objectStride, count, args, argStrides, static_cast<std::byte*>(retOut), retStride });
+        }
+
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedName;
+        }
+    
+    private:
+
+        auto AdjustSelf(void* self) const noexcept -> void*
+        {
+            if (virtualPath != nullptr)
+                return Detail::AdjustInherited(virtualPath, self);
+
+            return static_cast<std::byte*>(self) + selfOffset;
+        }
+    
+        std::string_view qualifiedName;
+        Caller caller;
+        BatchCaller batchCaller;
+        EmplaceCaller emplaceCaller;
+
+        ptrdiff_t selfOffset = 0;
+        const InheritedMethod* virtualPath = nullptr;
+    };
+
+    template <typename Binder, typename ClassT>
+    class MethodTypeTemplatedTyped
+    {
+
+    public:
+
+        MethodTypeTemplatedTyped(std::string_view qualifiedName) : qualifiedName(qualifiedName) { }
+        
+        template <typename T, typename... A>
+        auto Invoke(ClassT& self, A&&... a) const noexcept -> decltype(auto)
+        {
+            return Binder::template Call<T>(self, static_cast<A&&>(a)...);
+        }
+        
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedName;
+        }
+    
+    private:
+        
+        std::string_view qualifiedName;
+    };
+
+    class MethodTypeTemplatedErased
+    {
+
+    public:
+
+        using ErasedTemplatedCaller = void (*)(const std::type_info* const*, void*, void**, void*) noexcept;
+
+        MethodTypeTemplatedErased(std::string_view qualifiedName, ErasedTemplatedCaller caller, std::span<const TemplatedSpecialization> specializations = {}) : qualifiedName(qualifiedName), caller(caller), specializations(specializations) {}
+
+        auto InvokeWithType(const std::type_info* const* typeArgs, void* self, void** args, void* retOut) const noexcept -> void
+        {
+            caller(typeArgs, self, args, retOut);
+        }
+
+        auto Specialize(const std::type_info* const* typeArgs) const -> std::optional<MethodTypeErased>
+        {
+            for (const TemplatedSpecialization& s : specializations)
+            {
+                bool ok = true;
+
+                for (size_t i = 0; i < s.typeArgs.size() && ok; ++i)
+                    ok = s.typeArgs[i] == typeArgs[i] || *s.typeArgs[i] == *typeArgs[i];
+
+                if (ok)
+                    return MethodTypeErased(qualifiedName, s.caller);
+            }
+
+            return std::nullopt;
+        }
+
+        auto GetQualifiedName() const noexcept -> std::string_view
+        {
+            return qualifiedName;
+        }
+
+    private:
+
+        std::string_view qualifiedName;
+        mutable ErasedTemplatedCaller caller;
+        std::span<const TemplatedSpecialization> specializations;
+    };
+
+    namespace Detail
+    {
+        struct TypeSlotCell
+        {
+            std::atomic<const TypeDesc*> value = nullptr;
+            std::atomic<bool> linked = false;
+            TypeSlotCell* next = nullptr;
+        };
+
+        template <typename T>
+        struct TypeSlot
+        {
+            inline static TypeSlotCell cell;
+        };
+
+        struct ReaderRecord
+        {
+            std::atomic<uint64_t> pinnedEpoch = 0;
+            std::atomic<bool> inUse = false;
+            uint32_t depth = 0;
+            ReaderRecord* next = nullptr;
+        };
+    }
+
+    class Registry
+    {
+
+    public:
+
+        class Batch
+        {
+
+        public:
+
+            explicit Batch(Registry& registry) : registry(registry)
+            {
+                registry.BeginBatch();
+            }
+
+            ~Batch()
+            {
+                registry.EndBatch();
+            }
+
+            Batch(const Batch&) = delete;
+            Batch& operator=(const Batch&) = delete;
+
+        private:
+
+            Registry& registry;
+        };
+
+        static auto Instance() -> Registry&
+        {
+            static Registry r;
+
+            return r;
+        }
+
+        auto EnableConcurrentReads() -> void
+        {
+            std::lock_guard lock(writerMutex);
+
+            concurrentReads = true;
+            pinReads.store(!current->frozen, std::memory_order_release);
+        }
+
+        auto BeginBatch() -> void
+        {
+            writerMutex.lock();
+            ++batchDepth;
+        }
+
+        auto EndBatch() -> void
+        {
+            if (--batchDepth == 0)
+                Publish();
+
+            writerMutex.unlock();
+        }
+
+        auto ReclaimRetired() -> void
+        {
+            std::lock_guard lock(writerMutex);
+
+            retired.clear();
+            retiredHierarchy.clear();
+        }
+
+        auto RetiredSnapshots() -> size_t
+        {
+            std::lock_guard lock(writerMutex);
+
+            return retired.size();
+        }
+
+        auto AdoptedDescriptors() -> size_t
+        {
+            std::lock_guard lock(writerMutex);
+
+            return adoptedDescs.size();
+        }
+
+        auto Register(TypeDesc&& desc) -> const TypeDesc*
+        {
+            std::lock_guard lock(writerMutex);
+
+            if (current->frozen)
+                return nullptr;
+
+            if (const TypeDesc* existing = FindIn(WriterView(), desc.id))
+            {
+                if (existing->qualifiedName == desc.qualifiedName)
+                    return existing;
+
+                idCollisions.emplace_back(existing->qualifiedName, desc.qualifiedName);
+
+                return nullptr;
+            }
+
+            if (const LazyEntry* lazy = FindLazyIn(WriterView().lazyById, desc.id); lazy != nullptr && lazy->qualifiedName != desc.qualifiedName)
+            {
+                idCollisions.emplace_back(lazy->qualifiedName, desc.qualifiedName);
+
+                return nullptr;
+            }
+
+            TypeDesc& owned = adoptedDescs.emplace_back(std::move(desc));
+
+            if (!RegisterRange(&owned, &owned + 1))
+            {
+                adoptedDescs.pop_back();
+
+                return nullptr;
+            }
+
+            return &owned;
+        }
+
+        auto RegisterRange(const TypeDesc* begin, const TypeDesc* end) -> bool
+        {
+            std::lock_guard lock(writerMutex);
+
+            if (current->frozen)
+                return false;
+
+            Tables& w = Writable();
+            bool collided = false;
+
+            for (const TypeDesc* p = begin; p != end; ++p)
+            {
+                if (auto lazy = w.lazyById.find(p->id); lazy != w.lazyById.end() && lazy->second->qualifiedName != p->qualifiedName)
+                {
+                    idCollisions.emplace_back(lazy->second->qualifiedName, p->qualifiedName);
+                    collided = true;
+
+                    continue;
+                }
+
+                auto [it, inserted] = w.typeById.try_emplace(p->id, p);
+
+                if (!inserted)
+                {
+                    if (it->second->qualifiedName != p->qualifiedName)
+                    {
+                        idCollisions.emplace_back(it->second->qualifiedName, p->qualifiedName);
+                        collided = true;
+                    }
+
+                    continue;
+                }
+
+                TypeDesc& t = *const_cast<TypeDesc*>(p);
+
+                ResolveBaseOffsets(t);
+
+                if (!t.nameIndex.built)
+                    BuildNameIndex(t);
+
+                if (t.isPooled && t.pool == nullptr)
+                    t.pool = &pools.emplace_back(t.sizeInBytes, t.alignInBytes);
+
+                if (t.typeIndex == TypeDesc::NO_INDEX)
+                    t.typeIndex = nextTypeIndex++;
+
+                FixUpTemplatedForType(t);
+
+                w.nameToId.try_emplace(p->qualifiedName, p->id);
+                w.bySimpleName.emplace(p->name, p);
+
+                if (p->typeInfo != nullptr)
+                    w.byStdTypeIndex.try_emplace(std::type_index(*p->typeInfo), p->id);
+
+                InvalidateHierarchyCaches(p->id);
+            }
+
+            PublishIfIdle();
+
+            return !collided;
+        }
+
+        auto IdCollisions() -> std::vector<std::pair<std::string_view, std::string_view>>
+        {
+            std::lock_guard lock(writerMutex);
+
+            return idCollisions;
+        }
+
+        auto MapStdTypeIndex(std::type_index idx, TypeId id) -> bool
+        {
+            std::lock_guard lock(writerMutex);
+
+            if (current->frozen)
+                return false;
+
+            Writable().byStdTypeIndex.try_emplace(idx, id);
+
+            PublishIfIdle();
+
+            return true;
+        }
+
+        auto Freeze() -> void
+        {
+            std::unique_lock lock(writerMutex);
+
+            for (std::vector<LazyEntry*> lazy = UnmaterializedLazy(); !lazy.empty(); lazy = UnmaterializedLazy())
+            {
+                lock.unlock();
+
+                for (LazyEntry* e : lazy)
+                    Materialize(e);
+
+                lock.lock();
+            }
+
+            if (current->frozen)
+                return;
+
+            Publish();
+
+            const Tables& s = *current;
+            auto frozen = std::make_unique<Tables>();
+
+            frozen->frozen = true;
+            frozen->flatById = Flatten<TypeId>(s.typeById, [](const TypeDesc* t) { return t; });
+            frozen->flatByName = Flatten<std::string_view>(s.nameToId, [&](TypeId id) { return FindIn(s, id); });
+            frozen->flatByStdTypeIndex = Flatten<std::type_index>(s.byStdTypeIndex, [&](TypeId id) { return FindIn(s, id); });
+            frozen->flatBySimpleName = Flatten<std::string_view>(s.bySimpleName, [](const TypeDesc* t) { return t; });
+
+            for (const auto& [id, t] : s.typeById)
+            {
+                BuildAncestors(*t);
+                BuildInherited(*t);
+                BuildVirtualTable(*t);
+            }
+
+            pending = std::move(frozen);
+            Publish();
+            pinReads.store(false, std::memory_order_release);
+
+            if (!concurrentReads)
+            {
+                retired.clear();
+                retiredHierarchy.clear();
+            }
+        }
+
+        auto IsFrozen() const -> bool
+        {
+            const ReadPin pin(*this);
+
+            return Current().frozen;
+        }
+
+        template <class T>
+        auto MapType(TypeId id) -> void
+        {
+            MapStdTypeIndex(std::type_index(typeid(T)), id);
+
+            if (const TypeDesc* t = Find(id))
+                FillSlot(Detail::TypeSlot<std::remove_cv_t<T>>::cell, t);
+        }
+
+        using LazyBuilder = auto (*)() -> TypeDesc;
+
+        auto RegisterLazy(HashedName qualifiedName, const std::type_info* typeInfo, LazyBuilder build) -> bool
+        {
+            std::lock_guard lock(writerMutex);
+
+            if (current->frozen)
+                return false;
+
+            Tables& w = Writable();
+            const TypeId id = qualifiedName.id;
+
+            std::optional<std::string_view> existing;
+
+            if (const TypeDesc* t = FindIn(w, id))
+                existing = t->qualifiedName;
+            else if (auto it = w.lazyById.find(id); it != w.lazyById.end())
+                existing = it->second->qualifiedName;
+
+            if (existing.has_value())
+            {
+                if (*existing == qualifiedName.name)
+                    return true;
+
+                idCollisions.emplace_back(*existing, qualifiedName.name);
+
+                return false;
+            }
+
+            LazyEntry& e = lazyEntries.emplace_back();
+
+            e.id = id;
+            e.qualifiedName = qualifiedName.name;
+            e.typeInfo = typeInfo;
+            e.build = build;
+
+            w.lazyById.emplace(id, &e);
+            w.lazyBySimpleName.emplace(SimpleNameOf(qualifiedName.name), &e);
+
+            if (typeInfo != nullptr)
+                w.lazyByStdTypeIndex.emplace(std::type_index(*typeInfo), &e);
+
+            PublishIfIdle();
+
+            return true;
+        }
+
+        auto Find(TypeId id) const -> const TypeDesc*
+        {
+            const ReadPin pin(*this);
+            const Tables& s = Current();
+
+            if (const TypeDesc* t = FindIn(s, id))
+                return t;
+
+            return Materialize(FindLazyIn(s.lazyById, id));
+        }
+
+        auto Ancestors(const TypeDesc& t) const -> const AncestorTable&
+        {
+            if (const AncestorTable* cached = std::atomic_ref(const_cast<const AncestorTable*&>(t.ancestors)).load(std::memory_order_acquire))
+                return *cached;
+
+            MaterializeBases(t);
+
+            return BuildAncestors(t);
+        }
+
+        auto Inherited(const TypeDesc& t) const -> const InheritedView&
+        {
+            if (const InheritedView* cached = std::atomic_ref(const_cast<const InheritedView*&>(t.inherited)).load(std::memory_order_acquire))
+                return *cached;
+
+            MaterializeBases(t);
+
+            return BuildInherited(t);
+        }
+
+        auto VirtualTableOf(const TypeDesc& t) const -> const VirtualTable&
+        {
+            if (const VirtualTable* cached = std::atomic_ref(const_cast<const VirtualTable*&>(t.virtuals)).load(std::memory_order_acquire))
+                return *cached;
+
+            MaterializeBases(t);
+
+            return BuildVirtualTable(t);
+        }
+
+        auto SlotOf(const TypeDesc& t, std::string_view methodName) const -> VirtualSlot
+        {
+            const VirtualTable& table = VirtualTableOf(t);
+
+            for (const VirtualTable::Segment& s : table.segments)
+            {
+                for (uint32_t i = 0; i < s.count; ++i)
+                {
+                    const MethodDesc* m = table.slots[s.first + i].method;
+
+                    if (m->qualifiedName == methodName || Detail::MatchName(false, m->access, m->name, methodName))
+                        return VirtualSlot{ s.root, i };
+                }
+            }
+
+            return VirtualSlot{};
+        }
+
+        auto InvokeSlot(void* obj, const TypeDesc& dynamicType, VirtualSlot slot, void** args, void* retOut) const -> bool
+        {
+            const VirtualTable& table = VirtualTableOf(dynamicType);
+            const uint32_t i = table.IndexOf(slot);
+
+            if (i == VirtualSlot::NO_INDEX || table.slots[i].method->erasedCaller == nullptr)
+                return false;
+
+            const InheritedMethod& e = table.slots[i];
+
+            e.method->erasedCaller(Detail::AdjustInherited(&e, obj), args, retOut);
+
+            return true;
+        }
+
+        auto IsA(const TypeDesc& t, const TypeDesc& base) const -> bool
+        {
+            const AncestorTable& table = Ancestors(t);
+            const uint32_t bit = base.typeIndex;
+
+            if (bit == TypeDesc::NO_INDEX)
+                return std::ranges::any_of(table.entries, [&](const AncestorDesc& a) { return a.typeId == base.id; });
+
+            return (bit >> 6) < table.closure.size() && (table.closure[bit >> 6] >> (bit & 63)) & 1;
+        }
+
+        auto IsA(std::string_view name, std::string_view baseName) const -> bool
+        {
+            const TypeDesc* t = Get(name);
+            const TypeDesc* base = Get(baseName);
+
+            return t != nullptr && base != nullptr && IsA(*t, *base);
+        }
+
+        auto CastTo(void* obj, const TypeDesc& from, const TypeDesc& to) const -> void*
+        {
+            if (obj == nullptr || from.id == to.id)
+                return obj;
+
+            const AncestorTable& table = Ancestors(from);
+            const AncestorDesc* a = nullptr;
+
+            if (to.typeIndex != TypeDesc::NO_INDEX)
+                a = table.FindByTypeIndex(to.typeIndex);
+            else if (auto it = std::ranges::find(table.entries, to.id, &AncestorDesc::typeId); it != table.entries.end())
+                a = &*it;
+
+            if (a == nullptr || a->typeId != to.id)
+                return nullptr;
+
+            void* p = static_cast<std::byte*>(obj) + a->offsetInBytes;
+
+            if (a->virtualBase == nullptr)
+                return p;
+
+            p = a->virtualBase->adjustPtr(p);
+
+            if (a->virtualBase->baseTypeId == to.id)
+                return p;
+
+            const TypeDesc* hop = Find(a->virtualBase->baseTypeId);
+
+            return hop != nullptr ? CastTo(p, *hop, to) : nullptr;
+        }
+
+        auto CastTo(const void* obj, const TypeDesc& from, const TypeDesc& to) const -> const void*
+        {
+            return CastTo(const_cast<void*>(obj), from, to);
+        }
+
+        auto FindByQualifiedName(std::string_view qn) const -> const TypeDesc*
+        {
+            const ReadPin pin(*this);
+            const Tables& s = Current();
+
+            if (const TypeDesc* t = FindByQualifiedNameIn(s, qn))
+                return t;
+
+            LazyEntry* e = FindLazyIn(s.lazyById, TypeIdOf(qn));
+
+            return e != nullptr && e->qualifiedName == qn ? Materialize(e) : nullptr;
+        }
+
+        template <class T>
+        auto Get() const -> const TypeDesc*
+        {
+            Detail::TypeSlotCell& cell = Detail::TypeSlot<std::remove_cv_t<T>>::cell;
+
+            if (const TypeDesc* t = cell.value.load(std::memory_order_acquire))
+                return t;
+
+            const TypeDesc* t = Get(std::type_index(typeid(T)));
+
+            if (t != nullptr)
+                t = FillSlot(cell, t);
+
+            return t;
+        }
+
+        auto Get(std::type_index idx) const -> const TypeDesc*
+        {
+            const ReadPin pin(*this);
+            const Tables& s = Current();
+
+            if (const TypeDesc* t = FindByStdTypeIndexIn(s, idx))
+                return t;
+
+            return Materialize(FindLazyIn(s.lazyByStdTypeIndex, idx));
+        }
+
+        auto Get(std::string_view name) const -> const TypeDesc*
+        {
+            if (const TypeDesc* t = FindByQualifiedName(name))
+                return t;
+
+            MaterializeBySimpleName(name);
+
+            const ReadPin pin(*this);
+            const Tables& s = Current();
+
+            const TypeDesc* hit = nullptr;
+            size_t hits = 0;
+
+            VisitBySimpleNameIn(s, name, [&](const TypeDesc* t)
+                {
+                    hit = t;
+
+                    return ++hits < 2;
+                });
+
+            return hits == 1 ? hit : nullptr;
+        }
+
+        auto GetAllBySimpleName(std::string_view simpleName) const -> std::vector<const TypeDesc*>
+        {
+            MaterializeBySimpleName(simpleName);
+
+            std::vector<const TypeDesc*> v; v.reserve(2);
+            const ReadPin pin(*this);
+
+            VisitBySimpleNameIn(Current(), simpleName, [&](const TypeDesc* t)
+                {
+                    v.push_back(t);
+
+                    return true;
+                });
+
+            return v;
+        }
+
+        auto AttachTemplatedDispatcher(std::string_view classQualifiedName, std::string_view methodSimpleOrQualifiedName, MethodTypeTemplatedErased::ErasedTemplatedCaller caller, void* binderTag, std::span<const TemplatedSpecialization> specializations = {}) -> bool
+        {
+            std::lock_guard lock(writerMutex);
+
+            if (current->frozen)
+                return false;
+
+            Tables& w = Writable();
+
+            if (const TypeDesc* typeDesc = FindByQualifiedNameIn(w, classQualifiedName))
+            {
+                if (const TemplatedMethodDesc* hit = FindTemplatedMethod(*typeDesc, false, methodSimpleOrQualifiedName))
+                {
+                    const size_t index = static_cast<size_t>(hit - typeDesc->templatedMethods.data());
+                    TypeDesc& target = concurrentReads ? CopyForWrite(w, *typeDesc) : *const_cast<TypeDesc*>(typeDesc);
+                    TemplatedMethodDesc& m = const_cast<TemplatedMethodDesc&>(target.templatedMethods[index]);
+
+                    m.erasedTemplatedCaller = reinterpret_cast<void*>(caller);
+                    m.binderTag = binderTag;
+                    m.specializations = specializations;
+
+                    PublishIfIdle();
+
+                    return true;
+                }
+            }
+
+            PendingKey k{ std::string(classQualifiedName), std::string(methodSimpleOrQualifiedName) };
+
+            pendingTemplated[k] = PendingEntry{ caller, binderTag, specializations };
+
+            return false;
+        }
+
+        auto New(std::string_view typeName, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> void*
+        {
+            const TypeDesc* t = Get(typeName);
+            
+            if (!t)
+                return nullptr;
+            
+            return New(*t, args, argc, argTypes, accessibilityConsidered);
+        }
+
+        auto ConstructInto(std::string_view typeName, void* storage, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> bool
+        {
+            const TypeDesc* t = Get(typeName);
+
+            if (!t)
+                return false;
+            
+            return ConstructInto(*t, storage, args, argc, argTypes, accessibilityConsidered);
+        }
+
+        auto Delete(std::string_view typeName, void* p, bool accessibilityConsidered = true) -> bool
+        {
+            const TypeDesc* t = Get(typeName);
+            
+            if (!t)
+                return false;
+            
+            return Delete(*t, p, accessibilityConsidered);
+        }
+
+        template <class T>
+        auto New(void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> T*
+        {
+            const TypeDesc* t = Get<T>(); if (!t) return nullptr; return reinterpret_cast<T*>(New(*t, args, argc, argTypes, accessibilityConsidered));
+        }
+
+        auto GetPoolStats(std::string_view typeName) -> std::optional<ObjectPool::Stats>
+        {
+            const TypeDesc* t = Get(typeName);
+
+            if (!t || !t->pool)
+                return std::nullopt;
+
+            return t->pool->GetStats();
+        }
+
+        auto GetCtor(std::string_view typeName, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> CtorHandle
+        {
+            const TypeDesc* t = Get(typeName);
+
+            if (!t)
+                return {};
+
+            return CtorHandle(*t, ReflectMeta::FindCtor(*t, accessibilityConsidered, argc, argTypes));
+        }
+
+        template <class T, typename... Args>
+        auto GetCtor(bool accessibilityConsidered = true) -> CtorHandle
+        {
+            const TypeDesc* t = Get<T>();
+
+            if (!t)
+                return {};
+
+            return CtorHandle(*t, ReflectMeta::FindCtor(*t, accessibilityConsidered, sizeof...(Args), Detail::CtorArgTypes<Args...>::value));
+        }
+
+private:
+
+        struct PendingKey
+        {
+            std::string typeQN;
+            std::string method;
+
+            bool operator==(const PendingKey& o) const noexcept
+            {
+                return typeQN == o.typeQN && method == o.method;
+            }
+        };
+        struct PendingKeyHash
+        {
+            size_t operator()(const PendingKey& k) const noexcept
+            {
+                size_t h1 = std::hash<std::string>{}(k.typeQN);
+                size_t h2 = std::hash<std::string>{}(k.method);
+
+                return h1 ^ (h2 << 1);
+            }
+        };
+
+        struct PendingEntry
+        {
+            MethodTypeTemplatedErased::ErasedTemplatedCaller caller;
+            void* binderTag;
+            std::span<const TemplatedSpecialization> specializations;
+        };
+
+        template <typename K>
+        using FlatTable = std::vector<std::pair<K, const TypeDesc*>>;
+
+        struct LazyEntry
+        {
+            TypeId id;
+            std::string_view qualifiedName;
+            const std::type_info* typeInfo = nullptr;
+            LazyBuilder build = nullptr;
+
+            std::once_flag once;
+            std::atomic<const TypeDesc*> desc = nullptr;
+            std::atomic<bool> materialized = false;
+        };
+
+        struct Tables
+        {
+            std::unordered_map<TypeId, const TypeDesc*, TypeId::Hash> typeById;
+            std::unordered_map<std::string_view, TypeId> nameToId;
+            std::unordered_map<std::type_index, TypeId> byStdTypeIndex;
+            std::unordered_multimap<std::string_view, const TypeDesc*> bySimpleName;
+
+            std::unordered_map<TypeId, LazyEntry*, TypeId::Hash> lazyById;
+            std::unordered_map<std::type_index, LazyEntry*> lazyByStdTypeIndex;
+            std::unordered_multimap<std::string_view, LazyEntry*> lazyBySimpleName;
+
+            bool frozen = false;
+
+            FlatTable<TypeId> flatById;
+            FlatTable<std::string_view> flatByName;
+            FlatTable<std::type_index> flatByStdTypeIndex;
+            FlatTable<std::string_view> flatBySimpleName;
+        };
+
+        struct FlatKeyLess
+        {
+            auto operator()(const TypeId& a, const TypeId& b) const noexcept -> bool
+            {
+                return a.hi != b.hi ? a.hi < b.hi : a.lo < b.lo;
+            }
+
+            template <typename K>
+            auto operator()(const K& a, const K& b) const noexcept -> bool
+            {
+                return a < b;
+            }
+
+            template <typename K>
+            auto operator()(const std::pair<K, const TypeDesc*>& a, const K& b) const noexcept -> bool
+            {
+                return (*this)(a.first, b);
+            }
+
+            template <typename K>
+            auto operator()(const K& a, const std::pair<K, const TypeDesc*>& b) const noexcept -> bool
+            {
+                return (*this)(a, b.first);
+            }
+
+            template <typename K>
+            auto operator()(const std::pair<K, const TypeDesc*>& a, const std::pair<K, const TypeDesc*>& b) const noexcept -> bool
+            {
+                return (*this)(a.first, b.first);
+            }
+        };
+
+        template <typename K>
+        static auto FlatRange(const FlatTable<K>& table, const K& key) noexcept -> std::pair<typename FlatTable<K>::const_iterator, typename FlatTable<K>::const_iterator>
+        {
+            return std::equal_range(table.begin(), table.end(), key, FlatKeyLess{});
+        }
+
+        template <typename K>
+        static auto FlatFind(const FlatTable<K>& table, const K& key) noexcept -> const TypeDesc*
+        {
+            auto it = std::lower_bound(table.begin(), table.end(), key, FlatKeyLess{});
+
+            if (it == table.end() || FlatKeyLess{}(key, it->first))
+                return nullptr;
+
+            return it->second;
+        }
+
+        template <typename K, typename Map, typename Project>
+        static auto Flatten(const Map& map, Project&& project) -> FlatTable<K>
+        {
+            FlatTable<K> table;
+            table.reserve(map.size());
+
+            for (const auto& kv : map)
+            {
+                if (const TypeDesc* t = project(kv.second))
+                    table.emplace_back(kv.first, t);
+            }
+
+            std::stable_sort(table.begin(), table.end(), FlatKeyLess{});
+
+            return table;
+        }
+
+        auto New(const TypeDesc& t, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) -> void*
+        {
+            const CtorDesc* c = ReflectMeta::FindCtor(t, accessibilityConsidered, argc, argTypes);
+            
+            if (!c)
+                return nullptr;
+            
+            void* mem = AllocateObject(t);
+            
+            c->erasedCtor(mem, args);
+            
+            return mem;
+        }
+
+        auto ConstructInto(const TypeDesc& t, void* storage, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) -> bool
+        {
+            const CtorDesc* c = ReflectMeta::FindCtor(t, accessibilityConsidered, argc, argTypes);
+            
+            if (!c)
+                return false;
+            
+            c->erasedCtor(storage, args);
+            
+            return true;
+        }
+
+        auto Delete(const TypeDesc& t, void* p, bool accessibilityConsidered) -> bool
+        {
+            if (!t.destructor.has_value())
+                return false;
+            
+            const DtorDesc& d = *t.destructor;
+            
+            if (accessibilityConsidered && d.access != Access::PUBLIC)
+                return false; d.erasedDtor(p);
+            
+            FreeObject(t, p);
+            
+            return true;
+        }
+
+        void FixUpTemplatedForType(TypeDesc& t)
+        {
+            if (pendingTemplated.empty())
+                return;
+
+            for (const TemplatedMethodDesc& declared : t.templatedMethods)
+            {
+                TemplatedMethodDesc& m = const_cast<TemplatedMethodDesc&>(declared);
+
+                if (m.erasedTemplatedCaller)
+                    continue;
+
+                PendingKey k1{ std::string(t.qualifiedName), std::string(m.name) };
+                PendingKey k2{ std::string(t.qualifiedName), std::string(m.qualifiedName) };
+
+                auto tryApply = [&](const PendingKey& k)
+                {
+                    auto it = pendingTemplated.find(k);
+
+                    if (it == pendingTemplated.end())
+                        return false;
+
+                    m.erasedTemplatedCaller = reinterpret_cast<void*>(it->second.caller);
+                    m.binderTag = it->second.binderTag;
+                    m.specializations = it->second.specializations;
+
+                    pendingTemplated.erase(it);
+
+                    return true;
+                };
+
+                (void)(tryApply(k1) || tryApply(k2));
+            }
+        }
+
+        Registry() : current(std::make_unique<Tables>()), published(current.get()) { }
+
+        static auto FindIn(const Tables& s, TypeId id) -> const TypeDesc*
+        {
+            if (s.frozen)
+                return FlatFind(s.flatById, id);
+
+            auto it = s.typeById.find(id);
+
+            if (it == s.typeById.end())
+                return nullptr;
+
+            return it->second;
+        }
+
+        static auto FindByQualifiedNameIn(const Tables& s, std::string_view qn) -> const TypeDesc*
+        {
+            if (s.frozen)
+                return FlatFind(s.flatByName, qn);
+
+            auto it = s.nameToId.find(qn);
+
+            if (it == s.nameToId.end())
+                return nullptr;
+
+            return FindIn(s, it->second);
+        }
+
+        static auto FindByStdTypeIndexIn(const Tables& s, std::type_index idx) -> const TypeDesc*
+        {
+            if (s.frozen)
+                return FlatFind(s.flatByStdTypeIndex, idx);
+
+            auto it = s.byStdTypeIndex.find(idx);
+
+            if (it == s.byStdTypeIndex.end())
+                return nullptr;
+
+            return FindIn(s, it->second);
+        }
+
+        template <typename F>
+        static auto VisitBySimpleNameIn(const Tables& s, std::string_view simpleName, F&& visit) -> void
+        {
+            if (s.frozen)
+            {
+                auto [first, last] = FlatRange(s.flatBySimpleName, simpleName);
+
+                for (auto it = first; it != last && visit(it->second); ++it);
+            }
+            else
+            {
+                auto [first, last] = s.bySimpleName.equal_range(simpleName);
+
+                for (auto it = first; it != last && visit(it->second); ++it);
+            }
+        }
+
+        template <typename K, typename Map>
+        static auto FindLazyIn(const Map& lazy, const K& key) -> LazyEntry*
+        {
+            auto it = lazy.find(key);
+
+            return it == lazy.end() ? nullptr : it->second;
+        }
+
+        auto Materialize(LazyEntry* e) const -> const TypeDesc*
+        {
+            if (e == nullptr)
+                return nullptr;
+
+            std::call_once(e->once, [&]
+                {
+                    Registry& self = const_cast<Registry&>(*this);
+                    Batch batch(self);
+                    const TypeDesc* t = self.Register(e->build());
+
+                    if (t != nullptr && t->typeInfo == nullptr && e->typeInfo != nullptr)
+                        self.MapStdTypeIndex(std::type_index(*e->typeInfo), t->id);
+
+                    e->desc.store(t, std::memory_order_release);
+
+                    e->materialized.store(true, std::memory_order_release);
+                });
+
+            return e->desc.load(std::memory_order_acquire);
+        }
+
+        auto InvalidateHierarchyCaches(TypeId registered) -> void
+        {
+            std::vector<TypeId> work{ registered };
+
+            while (!work.empty())
+            {
+                auto it = hierarchyDependents.find(work.back());
+
+                work.pop_back();
+
+                if (it == hierarchyDependents.end())
+                    continue;
+
+                for (const TypeDesc* t : it->second)
+                {
+                    std::atomic_ref(const_cast<const AncestorTable*&>(t->ancestors)).store(nullptr, std::memory_order_release);
+                    std::atomic_ref(const_cast<const InheritedView*&>(t->inherited)).store(nullptr, std::memory_order_release);
+                    std::atomic_ref(const_cast<const VirtualTable*&>(t->virtuals)).store(nullptr, std::memory_order_release);
+
+                    if (auto owned = hierarchyStorage.find(t); owned != hierarchyStorage.end())
+                    {
+                        std::ranges::move(owned->second, std::back_inserter(retiredHierarchy));
+                        hierarchyStorage.erase(owned);
+                    }
+
+                    work.push_back(t->id);
+                }
+
+                hierarchyDependents.erase(it);
+            }
+        }
+
+        template <typename T>
+        auto KeepHierarchy(const TypeDesc& t, T&& value) -> T&
+        {
+            auto owned = std::make_shared<T>(std::move(value));
+            T& kept = *owned;
+
+            hierarchyStorage[&t].push_back(std::move(owned));
+
+            return kept;
+        }
+
+        auto TrackHierarchy(const TypeDesc& t) -> void
+        {
+            for (const BaseDesc& b : t.bases)
+            {
+                std::vector<const TypeDesc*>& dependents = hierarchyDependents[b.baseTypeId];
+
+                if (std::ranges::find(dependents, &t) == dependents.end())
+                    dependents.push_back(&t);
+            }
+        }
+
+        auto MaterializeBases(const TypeDesc& t) const -> void
+        {
+            for (const BaseDesc& b : t.bases)
+            {
+                if (const TypeDesc* base = Find(b.baseTypeId))
+                    MaterializeBases(*base);
+            }
+        }
+
+        auto BuildAncestors(const TypeDesc& t) const -> const AncestorTable&
+        {
+            Registry& self = const_cast<Registry&>(*this);
+            std::lock_guard lock(self.writerMutex);
+
+            if (const AncestorTable* cached = std::atomic_ref(const_cast<const AncestorTable*&>(t.ancestors)).load(std::memory_order_acquire))
+                return *cached;
+
+            std::vector<AncestorDesc> entries;
+
+            auto add = [&](const AncestorDesc& a)
+                {
+                    for (const AncestorDesc& e : entries)
+                    {
+                        if (e.typeId == a.typeId)
+                            return;
+                    }
+
+                    entries.push_back(a);
+                };
+
+            for (const BaseDesc& b : t.bases)
+            {
+                const BaseDesc* hop = b.isVirtual ? &b : nullptr;
+                const ptrdiff_t offset = b.isVirtual ? 0 : static_cast<ptrdiff_t>(b.offsetInBytes);
+
+                add(AncestorDesc{ b.baseTypeId, offset, hop });
+
+                const TypeDesc* base = FindIn(WriterView(), b.baseTypeId);
+
+                if (base == nullptr)
+                    continue;
+
+                for (const AncestorDesc& a : BuildAncestors(*base).entries)
+                    add(hop != nullptr ? AncestorDesc{ a.typeId, 0, hop } : AncestorDesc{ a.typeId, offset + a.offsetInBytes, a.virtualBase });
+            }
+
+            std::vector<uint64_t> closure;
+
+            auto mark = [&](uint32_t bit)
+                {
+                    if (bit == TypeDesc::NO_INDEX)
+                        return;
+
+                    if ((bit >> 6) >= closure.size())
+                        closure.resize((bit >> 6) + 1);
+
+                    closure[bit >> 6] |= uint64_t(1) << (bit & 63);
+                };
+
+            std::vector<std::pair<uint32_t, uint32_t>> indexed;
+
+            mark(t.typeIndex);
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(entries.size()); ++i)
+            {
+                const TypeDesc* ancestor = FindIn(WriterView(), entries[i].typeId);
+
+                if (ancestor == nullptr || ancestor->typeIndex == TypeDesc::NO_INDEX)
+                    continue;
+
+                mark(ancestor->typeIndex);
+                indexed.emplace_back(ancestor->typeIndex, i);
+            }
+
+            std::vector<AncestorTable::Slot> byTypeIndex;
+
+            if (!indexed.empty())
+            {
+                size_t capacity = 2;
+
+                while (capacity < indexed.size() * 2)
+                    capacity <<= 1;
 
-    public:
+                byTypeIndex.resize(capacity);
 
-        using ErasedTemplatedCaller = void (*)(const std::type_info* const*, void*, void**, void*) noexcept;
+                for (const auto& [typeIndex, i] : indexed)
+                {
+                    size_t s = typeIndex & (capacity - 1);
 
-        MethodTypeTemplatedErased(std::string_view qualifiedName, ErasedTemplatedCaller caller) : qualifiedName(qualifiedName), caller(caller) {}
+                    while (byTypeIndex[s].typeIndex != AncestorTable::NO_ENTRY)
+                        s = (s + 1) & (capacity - 1);
 
-        auto InvokeWithType(const std::type_info* const* typeArgs, void* self, void** args, void* retOut) const noexcept -> void
-        {
-            caller(typeArgs, self, args, retOut);
+                    byTypeIndex[s] = AncestorTable::Slot{ typeIndex, i };
+                }
+            }
+
+            AncestorTable& table = self.KeepHierarchy(t, AncestorTable{});
+
+            table.entries = self.KeepHierarchy(t, std::move(entries));
+            table.closure = self.KeepHierarchy(t, std::move(closure));
+            table.byTypeIndex = self.KeepHierarchy(t, std::move(byTypeIndex));
+
+            self.TrackHierarchy(t);
+            std::atomic_ref(const_cast<const AncestorTable*&>(t.ancestors)).store(&table, std::memory_order_release);
+
+            return table;
         }
 
-        auto GetQualifiedName() const noexcept -> std::string_view
+        auto BuildInherited(const TypeDesc& t) const -> const InheritedView&
         {
-            return qualifiedName;
-        }
+            Registry& self = const_cast<Registry&>(*this);
+            std::lock_guard lock(self.writerMutex);
 
-    private:
+            if (const InheritedView* cached = std::atomic_ref(const_cast<const InheritedView*&>(t.inherited)).load(std::memory_order_acquire))
+                return *cached;
 
-        std::string_view qualifiedName;
-        mutable ErasedTemplatedCaller caller;
-    };
+            std::vector<InheritedField> fields;
+            std::vector<InheritedMethod> methods;
 
-    class Registry
-    {
+            for (const FieldDesc& f : t.fields)
+                fields.push_back(InheritedField{ &f, f.access, static_cast<ptrdiff_t>(f.offsetInBytes), nullptr, nullptr, false });
 
-    public:
+            for (const MethodDesc& m : t.methods)
+                methods.push_back(InheritedMethod{ &m, m.access, 0, nullptr, nullptr, false });
 
-        static auto Instance() -> Registry&
-        {
-            static Registry r;
+            auto inherit = [&](auto& out, const auto& from, const BaseDesc& b, size_t own)
+                {
+                    const size_t siblings = out.size();
+                    const ptrdiff_t offset = b.isVirtual ? 0 : static_cast<ptrdiff_t>(b.offsetInBytes);
 
-            return r;
-        }
+                    for (const auto& e : from)
+                    {
+                        const std::string_view name = SimpleNameOf(Detail::QualifiedNameOf(*Detail::MemberOf(e)));
+                        const auto sameName = [&](const auto& o) { return SimpleNameOf(Detail::QualifiedNameOf(*Detail::MemberOf(o))) == name; };
+
+                        if (std::ranges::any_of(out.begin(), out.begin() + own, sameName))
+                            continue;
+
+                        auto entry = e;
+                        entry.access = std::max(e.access, b.access);
+
+                        if (b.isVirtual)
+                        {
+                            entry.offsetInBytes = 0;
+                            entry.virtualBase = &b;
+                            entry.next = &e;
+                        }
+                        else
+                            entry.offsetInBytes += offset;
+
+                        bool merged = false;
+
+                        for (auto& o : std::span(out).subspan(own, siblings - own))
+                        {
+                            if (!sameName(o))
+                                continue;
+
+                            if (SharesSubobject(o, entry) || Dominates(o, entry))
+                                merged = true;
+                            else if (Dominates(entry, o))
+                            {
+                                o = entry;
+                                merged = true;
+                            }
+                            else
+                            {
+                                o.isAmbiguous = true;
+                                entry.isAmbiguous = true;
+                            }
+                        }
+
+                        if (!merged)
+                            out.push_back(entry);
+                    }
+                };
 
-        auto RegisterRange(const TypeDesc* begin, const TypeDesc* end) -> void
-        {
-            for (const TypeDesc* p = begin; p != end; ++p)
+            for (const BaseDesc& b : t.bases)
+            {
+                const TypeDesc* base = FindIn(WriterView(), b.baseTypeId);
+
+                if (base == nullptr)
+                    continue;
+
+                const InheritedView& v = BuildInherited(*base);
+
+                inherit(fields, v.fields, b, t.fields.size());
+                inherit(methods, v.methods, b, t.methods.size());
+            }
+
+            InheritedView& view = self.KeepHierarchy(t, InheritedView{});
+
+            view.fields = self.KeepHierarchy(t, std::move(fields));
+            view.methods = self.KeepHierarchy(t, std::move(methods));
+
+            if (!view.fields.empty())
+                view.fieldIndex.Reserve(view.fields.size() * 2, self.KeepHierarchy(t, std::vector<NameIndex::Slot>{}));
+
+            if (!view.methods.empty())
+                view.methodIndex.Reserve(view.methods.size() * 3, self.KeepHierarchy(t, std::vector<NameIndex::Slot>{}));
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(view.fields.size()); ++i)
+            {
+                view.fieldIndex.Insert(view.fields[i].field->name, i, view.fields[i].access);
+
+                if (!view.fields[i].isAmbiguous)
+                    view.fieldIndex.Insert(SimpleNameOf(view.fields[i].field->name), i, view.fields[i].access);
+            }
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(view.methods.size()); ++i)
             {
-                auto [it, inserted] = typeById.emplace(p->id, p);
-                nameToId.emplace(p->qualifiedName, p->id);
+                if (!view.methods[i].isAmbiguous)
+                {
+                    view.methodIndex.Insert(view.methods[i].method->name, i, view.methods[i].access);
+                    view.methodIndex.Insert(SimpleNameOf(view.methods[i].method->name), i, view.methods[i].access);
+                }
 
-                FixUpTemplatedForType(*const_cast<TypeDesc*>(p));
+                view.methodIndex.Insert(view.methods[i].method->qualifiedName, i, view.methods[i].access);
             }
+
+            self.TrackHierarchy(t);
+            std::atomic_ref(const_cast<const InheritedView*&>(t.inherited)).store(&view, std::memory_order_release);
+
+            return view;
         }
 
-        auto MapStdTypeIndex(std::type_index idx, TypeId id) -> void
+        template <typename Entry>
+        static auto SharesSubobject(const Entry& a, const Entry& b) noexcept -> bool
         {
-            byStdTypeIndex.emplace(idx, id);
+            const BaseDesc* va = Detail::VirtualSubobjectOf(a);
+            const BaseDesc* vb = Detail::VirtualSubobjectOf(b);
+
+            return Detail::MemberOf(a) == Detail::MemberOf(b) && va != nullptr && vb != nullptr && va->baseTypeId == vb->baseTypeId;
         }
 
-        auto Find(TypeId id) const -> const TypeDesc*
+        template <typename Entry>
+        auto Dominates(const Entry& winner, const Entry& loser) const -> bool
         {
-            auto it = typeById.find(id);
+            const BaseDesc* shared = Detail::VirtualSubobjectOf(loser);
 
-            if (it == typeById.end())
-                return nullptr;
+            if (shared == nullptr)
+                return false;
 
-            return it->second;
+            const std::string_view qualifiedName = Detail::QualifiedNameOf(*Detail::MemberOf(winner));
+            const std::string_view owner = qualifiedName.substr(0, qualifiedName.size() - std::min(qualifiedName.size(), SimpleNameOf(qualifiedName).size() + 2));
+            const TypeDesc* ownerDesc = FindIn(WriterView(), TypeIdOf(owner));
+
+            if (ownerDesc == nullptr || ownerDesc->id == shared->baseTypeId)
+                return false;
+
+            return std::ranges::any_of(BuildAncestors(*ownerDesc).entries, [&](const AncestorDesc& a) { return a.typeId == shared->baseTypeId && a.virtualBase != nullptr; });
         }
 
-        auto FindByQualifiedName(std::string_view qn) const -> const TypeDesc*
+        auto BuildVirtualTable(const TypeDesc& t) const -> const VirtualTable&
         {
-            auto it = nameToId.find(qn);
+            Registry& self = const_cast<Registry&>(*this);
+            std::lock_guard lock(self.writerMutex);
 
-            if (it == nameToId.end())
-                return nullptr;
+            if (const VirtualTable* cached = std::atomic_ref(const_cast<const VirtualTable*&>(t.virtuals)).load(std::memory_order_acquire))
+                return *cached;
 
-            return Find(it->second);
-        }
+            std::vector<VirtualTable::Segment> segments;
+            std::vector<InheritedMethod> slots;
 
-        template <class T>
-        auto Get() const -> const TypeDesc*
-        {
-            auto it = byStdTypeIndex.find(std::type_index(typeid(T)));
+            for (const BaseDesc& b : t.bases)
+            {
+                const TypeDesc* base = FindIn(WriterView(), b.baseTypeId);
 
-            if (it == byStdTypeIndex.end())
-                return nullptr;
+                if (base == nullptr)
+                    continue;
 
-            return Find(it->second);
-        }
+                const VirtualTable& inheritedTable = BuildVirtualTable(*base);
+                const ptrdiff_t offset = b.isVirtual ? 0 : static_cast<ptrdiff_t>(b.offsetInBytes);
 
-        auto Get(std::string_view name) const -> const TypeDesc*
-        {
-            if (const TypeDesc* t = FindByQualifiedName(name))
-                return t;
+                for (const VirtualTable::Segment& s : inheritedTable.segments)
+                {
+                    if (std::ranges::any_of(segments, [&](const VirtualTable::Segment& o) { return o.root == s.root; }))
+                        continue;
 
-            const TypeDesc* hit = nullptr;
+                    segments.push_back(VirtualTable::Segment{ s.root, static_cast<uint32_t>(slots.size()), s.count });
+
+                    for (const InheritedMethod& e : inheritedTable.slots.subspan(s.first, s.count))
+                    {
+                        InheritedMethod entry = e;
+
+                        if (b.isVirtual)
+                        {
+                            entry.offsetInBytes = 0;
+                            entry.virtualBase = &b;
+                            entry.next = &e;
+                        }
+                        else
+                            entry.offsetInBytes += offset;
+
+                        slots.push_back(entry);
+                    }
+                }
+            }
 
-            for (const auto& kv : typeById)
+            const uint32_t inheritedCount = static_cast<uint32_t>(slots.size());
+
+            for (const MethodDesc& m : t.methods)
             {
-                const TypeDesc* p = kv.second;
+                if (!m.isVirtual || m.isStatic)
+                    continue;
 
-                if (p != nullptr && p->name == name)
+                const uint64_t signature = Detail::VirtualSignatureOf(m);
+                bool overrides = false;
+
+                for (InheritedMethod& e : std::span(slots).first(inheritedCount))
                 {
-                    if (hit != nullptr)
-                        return nullptr;
+                    if (Detail::VirtualSignatureOf(*e.method) != signature)
+                        continue;
 
-                    hit = p;
+                    e = InheritedMethod{ &m, m.access, 0, nullptr, nullptr, false };
+                    overrides = true;
                 }
+
+                if (!overrides)
+                    slots.push_back(InheritedMethod{ &m, m.access, 0, nullptr, nullptr, false });
             }
 
-            return hit;
+            if (slots.size() > inheritedCount)
+                segments.push_back(VirtualTable::Segment{ t.id, inheritedCount, static_cast<uint32_t>(slots.size()) - inheritedCount });
+
+            VirtualTable& table = self.KeepHierarchy(t, VirtualTable{});
+
+            table.segments = self.KeepHierarchy(t, std::move(segments));
+            table.slots = self.KeepHierarchy(t, std::move(slots));
+
+            self.TrackHierarchy(t);
+            std::atomic_ref(const_cast<const VirtualTable*&>(t.virtuals)).store(&table, std::memory_order_release);
+
+            return table;
         }
 
-        auto GetAllBySimpleName(std::string_view simpleName) const -> std::vector<const TypeDesc*>
+        auto MaterializeBySimpleName(std::string_view simpleName) const -> void
         {
-            std::vector<const TypeDesc*> v; v.reserve(2);
+            std::vector<LazyEntry*> candidates;
 
-            for (const auto& kv : typeById)
             {
-                const TypeDesc* p = kv.second;
+                const ReadPin pin(*this);
+                auto [first, last] = Current().lazyBySimpleName.equal_range(simpleName);
 
-                if (p != nullptr && p->name == simpleName)
-                    v.push_back(p);
+                for (auto it = first; it != last; ++it)
+                    candidates.push_back(it->second);
             }
 
-            return v;
+            for (LazyEntry* e : candidates)
+                Materialize(e);
         }
 
-        auto AttachTemplatedDispatcher(std::string_view classQualifiedName, std::string_view methodSimpleOrQualifiedName, MethodTypeTemplatedErased::ErasedTemplatedCaller caller, void* binderTag) -> bool
+        auto UnmaterializedLazy() const -> std::vector<LazyEntry*>
         {
-            if (const TypeDesc* typeDesc = FindByQualifiedName(classQualifiedName))
-            {
-                TypeDesc* t = const_cast<TypeDesc*>(typeDesc);
+            std::vector<LazyEntry*> v;
 
-                for (TemplatedMethodDesc& m : t->templatedMethods)
-                {
-                    if (MatchName(m.name, methodSimpleOrQualifiedName) || MatchName(m.qualifiedName, methodSimpleOrQualifiedName))
-                    {
-                        m.erasedTemplatedCaller = reinterpret_cast<void*>(caller);
-                        m.binderTag = binderTag;
-
-                        return true;
-                    }
-                }
+            for (const auto& kv : WriterView().lazyById)
+            {
+                if (!kv.second->materialized.load(std::memory_order_acquire))
+                    v.push_back(kv.second);
             }
 
-            PendingKey k{ std::string(classQualifiedName), std::string(methodSimpleOrQualifiedName) };
-
-            pendingTemplated[k] = PendingEntry{ caller, binderTag };
+            return v;
+        }
 
-            return false;
+        auto Current() const noexcept -> const Tables&
+        {
+            return *published.load(std::memory_order_seq_cst);
         }
 
-        auto New(std::string_view typeName, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> void*
+        auto WriterView() const noexcept -> const Tables&
         {
-            const TypeDesc* t = Get(typeName);
-            
-            if (!t)
-                return nullptr;
-            
-            return New(*t, args, argc, argTypes, accessibilityConsidered);
+            return pending ? *pending : *current;
         }
 
-        auto ConstructInto(std::string_view typeName, void* storage, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> bool
+        auto Writable() -> Tables&
         {
-            const TypeDesc* t = Get(typeName);
+            if (!concurrentReads)
+                return *current;
 
-            if (!t)
-                return false;
-            
-            return ConstructInto(*t, storage, args, argc, argTypes, accessibilityConsidered);
+            if (!pending)
+                pending = std::make_unique<Tables>(*current);
+
+            return *pending;
         }
 
-        auto Delete(std::string_view typeName, void* p, bool accessibilityConsidered = true) -> bool
+        auto PublishIfIdle() -> void
         {
-            const TypeDesc* t = Get(typeName);
-            
-            if (!t)
-                return false;
-            
-            return Delete(*t, p, accessibilityConsidered);
+            if (batchDepth == 0)
+                Publish();
         }
 
-        template <class T>
-        auto New(void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered = true) -> T*
+        auto Publish() -> void
         {
-            const TypeDesc* t = Get<T>(); if (!t) return nullptr; return reinterpret_cast<T*>(New(*t, args, argc, argTypes, accessibilityConsidered));
-        }
+            if (!pending)
+                return;
 
-private:
+            std::unique_ptr<Tables> replacedTables = std::move(current);
 
-        struct PendingKey
-        {
-            std::string typeQN;
-            std::string method;
+            current = std::move(pending);
+            published.store(current.get(), std::memory_order_seq_cst);
+            retired.emplace_back(epoch.fetch_add(1, std::memory_order_seq_cst) + 1, std::move(replacedTables));
 
-            bool operator==(const PendingKey& o) const noexcept
-            {
-                return typeQN == o.typeQN && method == o.method;
-            }
-        };
-        struct PendingKeyHash
-        {
-            size_t operator()(const PendingKey& k) const noexcept
+            for (const auto& [from, to] : replaced)
             {
-                size_t h1 = std::hash<std::string>{}(k.typeQN);
-                size_t h2 = std::hash<std::string>{}(k.method);
+                for (Detail::TypeSlotCell* cell = slotCells.load(); cell != nullptr; cell = cell->next)
+                {
+                    const TypeDesc* expected = from;
 
-                return h1 ^ (h2 << 1);
+                    cell->value.compare_exchange_strong(expected, to);
+                }
             }
-        };
 
-        struct PendingEntry
-        {
-            MethodTypeTemplatedErased::ErasedTemplatedCaller caller;
-            void* binderTag;
-        };
+            replaced.clear();
+
+            ReclaimQuiescent();
+        }
 
-        static auto MatchCtor(const CtorDesc& c, size_t argc, const std::type_info* const* argTypes) noexcept -> bool
+        auto ReclaimQuiescent() -> void
         {
-            if (c.parameters.size() != argc)
-                return false;
+            uint64_t oldestPin = UINT64_MAX;
 
-            for (size_t i = 0; i < argc; ++i)
+            for (Detail::ReaderRecord* r = readers.load(std::memory_order_acquire); r != nullptr; r = r->next)
             {
-                if (c.parameters[i].type.qualifiedName != std::string_view(argTypes[i]->name()))
-                    return false;
+                if (const uint64_t pinned = r->pinnedEpoch.load(std::memory_order_seq_cst); pinned != 0)
+                    oldestPin = std::min(oldestPin, pinned);
             }
 
-            return true;
+            std::erase_if(retired, [&](const auto& r) { return r.first <= oldestPin; });
         }
 
-        static auto FindCtor(const TypeDesc& t, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) -> const CtorDesc*
+        class ReadPin
         {
-            for (const CtorDesc& c : t.constructors)
+
+        public:
+
+            explicit ReadPin(const Registry& registry) : record(registry.pinReads.load(std::memory_order_acquire) ? &registry.ThreadRecord() : nullptr)
             {
-                if (!c.erasedCtor)
-                    continue;
+                if (record != nullptr && record->depth++ == 0)
+                    record->pinnedEpoch.store(registry.epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
 
-                if (accessibilityConsidered && c.access != Access::PUBLIC)
-                    continue;
+            ~ReadPin()
+            {
+                if (record != nullptr && --record->depth == 0)
+                    record->pinnedEpoch.store(0, std::memory_order_release);
+            }
 
-                if (c.parameters.size() != argc)
-                    continue;
+            ReadPin(const ReadPin&) = delete;
+            ReadPin& operator=(const ReadPin&) = delete;
 
-                bool ok = true;
+        private:
+
+            Detail::ReaderRecord* record;
+        };
+
+        auto ThreadRecord() const -> Detail::ReaderRecord&
+        {
+            struct Lease
+            {
+                Detail::ReaderRecord* record = nullptr;
 
-                for (size_t i = 0; i < argc; ++i)
+                ~Lease()
                 {
-                    if (c.parameters[i].type.qualifiedName != std::string_view(argTypes[i]->name()))
-                    {
-                        ok = false;
-                        break;
-                    }
+                    if (record != nullptr)
+                        record->inUse.store(false, std::memory_order_release);
                 }
+            };
 
-                if (ok)
-                    return &c;
+            thread_local Lease lease;
+
+            if (lease.record != nullptr)
+                return *lease.record;
+
+            for (Detail::ReaderRecord* r = readers.load(std::memory_order_acquire); r != nullptr; r = r->next)
+            {
+                bool expected = false;
+
+                if (r->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                    return *(lease.record = r);
             }
 
-            return nullptr;
-        }
+            Detail::ReaderRecord* r = new Detail::ReaderRecord();
+            Detail::ReaderRecord* head = readers.load();
 
-        auto New(const TypeDesc& t, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) -> void*
-        {
-            const CtorDesc* c = FindCtor(t, argc, argTypes, accessibilityConsidered);
-            
-            if (!c)
-                return nullptr;
-            
-            void* mem = ::operator new(t.sizeInBytes, std::align_val_t(t.alignInBytes));
-            
-            c->erasedCtor(mem, args);
-            
-            return mem;
-        }
+            r->inUse.store(true, std::memory_order_relaxed);
 
-        auto ConstructInto(const TypeDesc& t, void* storage, void** args, size_t argc, const std::type_info* const* argTypes, bool accessibilityConsidered) -> bool
-        {
-            const CtorDesc* c = FindCtor(t, argc, argTypes, accessibilityConsidered);
-            
-            if (!c)
-                return false;
-            
-            c->erasedCtor(storage, args);
-            
-            return true;
-        }
+            do
+                r->next = head;
+            while (!readers.compare_exchange_weak(head, r));
 
-        auto Delete(const TypeDesc& t, void* p, bool accessibilityConsidered) -> bool
-        {
-            if (!t.destructor.has_value())
-                return false;
-            
-            const DtorDesc& d = *t.destructor;
-            
-            if (accessibilityConsidered && d.access != Access::PUBLIC)
-                return false; d.erasedDtor(p);
-            
-            ::operator delete(p, std::align_val_t(t.alignInBytes));
-            
-            return true;
+            return *(lease.record = r);
         }
 
-        static bool MatchName(std::string_view stored, std::string_view q) noexcept
+        auto ResolveBaseOffsets(TypeDesc& t) -> void
         {
-            return stored == q || (stored.rfind("::") != std::string_view::npos && stored.substr(stored.rfind("::") + 2) == q);
+            if (std::ranges::none_of(t.bases, [](const BaseDesc& b) { return b.offsetInBytes == BaseDesc::UNRESOLVED_OFFSET; }))
+                return;
+
+            std::vector<BaseDesc>& bases = resolvedBases.emplace_back(t.bases.begin(), t.bases.end());
+
+            for (BaseDesc& b : bases)
+            {
+                if (b.offsetInBytes == BaseDesc::UNRESOLVED_OFFSET)
+                    b.offsetInBytes = b.offsetOf();
+            }
+
+            t.bases = bases;
         }
 
-        void FixUpTemplatedForType(TypeDesc& t)
+        auto CopyForWrite(Tables& w, const TypeDesc& t) -> TypeDesc&
         {
-            for (TemplatedMethodDesc& m : t.templatedMethods)
+            TypeDesc* copy = ownedDescs.emplace_back(std::make_unique<TypeDesc>(t)).get();
+
+            copy->templatedMethods = DescriptorArena::Module().Copy(t.templatedMethods, DescriptorArena::Region::COLD);
+            copy->ancestors = nullptr;
+            copy->inherited = nullptr;
+            copy->virtuals = nullptr;
+
+            w.typeById[t.id] = copy;
+
+            auto [first, last] = w.bySimpleName.equal_range(t.name);
+
+            for (auto it = first; it != last; ++it)
             {
-                if (m.erasedTemplatedCaller)
-                    continue;
+                if (it->second == &t)
+                    it->second = copy;
+            }
 
-                PendingKey k1{ std::string(t.qualifiedName), std::string(m.name) };
-                PendingKey k2{ std::string(t.qualifiedName), std::string(m.qualifiedName) };
+            replaced.emplace_back(&t, copy);
 
-                auto tryApply = [&](const PendingKey& k)
-                {
-                    auto it = pendingTemplated.find(k);
+            return *copy;
+        }
 
-                    if (it == pendingTemplated.end())
-                        return false;
+        auto FillSlot(Detail::TypeSlotCell& cell, const TypeDesc* t) const -> const TypeDesc*
+        {
+            if (!cell.linked.exchange(true))
+            {
+                Detail::TypeSlotCell* head = slotCells.load();
 
-                    m.erasedTemplatedCaller = reinterpret_cast<void*>(it->second.caller);
-                    m.binderTag = it->second.binderTag;
+                do
+                    cell.next = head;
+                while (!slotCells.compare_exchange_weak(head, &cell));
+            }
 
-                    pendingTemplated.erase(it);
+            for (;;)
+            {
+                cell.value.store(t, std::memory_order_seq_cst);
 
-                    return true;
-                };
+                const TypeDesc* latest = Find(t->id);
 
-                (void)(tryApply(k1) || tryApply(k2));
+                if (latest == nullptr || latest == t)
+                    return t;
+
+                t = latest;
             }
         }
 
-        std::unordered_map<TypeId, const TypeDesc*, TypeId::Hash> typeById;
-        std::unordered_map<std::string_view, TypeId> nameToId;
-        std::unordered_map<std::type_index, TypeId> byStdTypeIndex;
+        std::unique_ptr<Tables> current;
+        std::unique_ptr<Tables> pending;
+        std::atomic<const Tables*> published;
+
+        std::vector<std::pair<uint64_t, std::unique_ptr<Tables>>> retired;
+        std::atomic<uint64_t> epoch = 1;
+        std::atomic<bool> pinReads = false;
+        mutable std::atomic<Detail::ReaderRecord*> readers = nullptr;
+        std::vector<std::unique_ptr<TypeDesc>> ownedDescs;
+        std::deque<LazyEntry> lazyEntries;
+        std::deque<TypeDesc> adoptedDescs;
+        std::deque<std::vector<BaseDesc>> resolvedBases;
+        std::deque<ObjectPool> pools;
+        std::unordered_map<const TypeDesc*, std::vector<std::shared_ptr<const void>>> hierarchyStorage;
+        std::unordered_map<TypeId, std::vector<const TypeDesc*>, TypeId::Hash> hierarchyDependents;
+        std::vector<std::shared_ptr<const void>> retiredHierarchy;
+        uint32_t nextTypeIndex = 0;
+        std::vector<std::pair<const TypeDesc*, const TypeDesc*>> replaced;
+
+        mutable std::atomic<Detail::TypeSlotCell*> slotCells = nullptr;
+
+        std::recursive_mutex writerMutex;
+        size_t batchDepth = 0;
+        bool concurrentReads = false;
+
         std::unordered_map<PendingKey, PendingEntry, PendingKeyHash> pendingTemplated;
 
+        std::vector<std::pair<std::string_view, std::string_view>> idCollisions;
+
+
     };
 
     template <typename Tag, typename T>
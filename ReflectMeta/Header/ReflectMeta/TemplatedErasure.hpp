@@ -1,4 +1,8 @@
 #pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <tuple>
 #include <typeinfo>
 #include <type_traits>
 #include <utility>
@@ -37,6 +41,13 @@ namespace ReflectMeta
 
         template <typename U>
         struct ParamPtrPtr final { using Type = U**; };
+
+        template <size_t I, template <typename> class E>
+        struct On final
+        {
+            template <typename... Ts>
+            struct Expr final { using Type = typename E<std::tuple_element_t<I, std::tuple<Ts...>>>::Type; };
+        };
     }
 
     template <typename P>
@@ -61,18 +72,273 @@ namespace ReflectMeta
             Binder::template Call<T>(object, Fetch<typename AExprs<T>::Type>(args, I)...);
     }
 
+    namespace Detail
+    {
+        // Up to this many types a chain of type_info comparisons beats hashing into the table.
+        inline constexpr size_t LINEAR_DISPATCH_LIMIT = 4;
+
+        template <size_t N, size_t K = 1>
+        class TypeDispatchTable final
+        {
+
+        public:
+
+            static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+            explicit TypeDispatchTable(const std::array<const std::type_info*, N * K>& types) noexcept : keys(types)
+            {
+                for (size_t i = 0; i < N; ++i)
+                {
+                    size_t addressHash = 0;
+                    size_t hashCode = 0;
+
+                    for (size_t k = 0; k < K; ++k)
+                    {
+                        addressHash = Combine(addressHash, AddressHash(types[i * K + k]));
+                        hashCode = Combine(hashCode, types[i * K + k]->hash_code());
+                    }
+
+                    Insert(byAddress, addressHash, i);
+                    Insert(byHashCode, hashCode, i);
+                }
+            }
+
+            auto Find(const std::type_info* const* ids) const noexcept -> size_t
+            {
+                size_t addressHash = 0;
+
+                for (size_t k = 0; k < K; ++k)
+                    addressHash = Combine(addressHash, AddressHash(ids[k]));
+
+                for (size_t s = addressHash & MASK; byAddress[s].index != NOT_FOUND; s = (s + 1) & MASK)
+                {
+                    if (byAddress[s].hash == addressHash && SameAddresses(byAddress[s].index, ids))
+                        return byAddress[s].index;
+                }
+
+                size_t hashCode = 0;
+
+                for (size_t k = 0; k < K; ++k)
+                    hashCode = Combine(hashCode, ids[k]->hash_code());
+
+                for (size_t s = hashCode & MASK; byHashCode[s].index != NOT_FOUND; s = (s + 1) & MASK)
+                {
+                    if (byHashCode[s].hash == hashCode && SameTypes(byHashCode[s].index, ids))
+                        return byHashCode[s].index;
+                }
+
+                return NOT_FOUND;
+            }
+
+        private:
+
+            static constexpr size_t SLOTS = std::bit_ceil(N * 2 < 2 ? size_t(2) : N * 2);
+            static constexpr size_t MASK = SLOTS - 1;
+
+            struct Slot
+            {
+                size_t hash = 0;
+                size_t index = NOT_FOUND;
+            };
+
+            static auto AddressHash(const std::type_info* p) noexcept -> size_t
+            {
+                return static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)) * 0x9E3779B97F4A7C15ull) >> 32);
+            }
+
+            static auto Combine(size_t seed, size_t h) noexcept -> size_t
+            {
+                return seed ^ (h + 0x9E3779B9u + (seed << 6) + (seed >> 2));
+            }
+
+            static auto Insert(std::array<Slot, SLOTS>& slots, size_t hash, size_t index) noexcept -> void
+            {
+                size_t s = hash & MASK;
+
+                while (slots[s].index != NOT_FOUND)
+                    s = (s + 1) & MASK;
+
+                slots[s] = Slot{ hash, index };
+            }
+
+            auto SameAddresses(size_t index, const std::type_info* const* ids) const noexcept -> bool
+            {
+                for (size_t k = 0; k < K; ++k)
+                {
+                    if (keys[index * K + k] != ids[k])
+                        return false;
+                }
+
+                return true;
+            }
+
+            auto SameTypes(size_t index, const std::type_info* const* ids) const noexcept -> bool
+            {
+                for (size_t k = 0; k < K; ++k)
+                {
+                    if (*keys[index * K + k] != *ids[k])
+                        return false;
+                }
+
+                return true;
+            }
+
+            std::array<const std::type_info*, N * K> keys;
+            std::array<Slot, SLOTS> byAddress{};
+            std::array<Slot, SLOTS> byHashCode{};
+        };
+
+        template <typename... A, typename... B>
+        auto operator+(TypeList<A...>, TypeList<B...>) -> TypeList<A..., B...>;
+
+        template <typename... Lists>
+        struct Concat final { using Type = decltype((TypeList<>{} + ... + Lists{})); };
+
+        template <typename Prefix, typename... Lists>
+        struct Product;
+
+        template <typename... P>
+        struct Product<TypeList<P...>> final { using Type = TypeList<TypeList<P...>>; };
+
+        template <typename... P, typename... Head, typename... Tail>
+        struct Product<TypeList<P...>, TypeList<Head...>, Tail...> final { using Type = typename Concat<typename Product<TypeList<P..., Head>, Tail...>::Type...>::Type; };
+
+        template <template <typename> class Pred, typename List>
+        struct Filter;
+
+        template <template <typename> class Pred, typename... Ts>
+        struct Filter<Pred, TypeList<Ts...>> final { using Type = typename Concat<std::conditional_t<Pred<Ts>::value, TypeList<Ts>, TypeList<>>...>::Type; };
+    }
+
     template <typename List>
     struct TypeSwitch;
 
     template <typename... Ts>
     struct TypeSwitch<TypeList<Ts...>>
     {
+        static constexpr size_t NOT_FOUND = Detail::TypeDispatchTable<sizeof...(Ts)>::NOT_FOUND;
+
+        static inline auto IndexOf(const std::type_info& id) noexcept -> size_t
+        {
+            if constexpr (sizeof...(Ts) <= Detail::LINEAR_DISPATCH_LIMIT)
+            {
+                size_t i = 0;
+
+                return ((id == typeid(Ts) || (++i, false)) || ...) ? i : NOT_FOUND;
+            }
+            else
+            {
+                static const Detail::TypeDispatchTable<sizeof...(Ts)> table{ { &typeid(Ts)... } };
+                const std::type_info* ids[] = { &id };
+
+                return table.Find(ids);
+            }
+        }
+
         template <typename F>
         static inline auto Apply(const std::type_info& id, F&& f) noexcept -> bool
         {
-            bool matched = false;
-            ((id == typeid(Ts) ? (f.template operator() < Ts > (), matched = true) : false) || ...);
-            return matched;
+            if constexpr (sizeof...(Ts) <= Detail::LINEAR_DISPATCH_LIMIT)
+                return ((id == typeid(Ts) && (f.template operator() < Ts > (), true)) || ...);
+            else
+            {
+                using Fn = std::remove_reference_t<F>;
+
+                static constexpr void (*thunks[])(Fn&) noexcept = { &Dispatch<Fn, Ts>... };
+
+                const size_t i = IndexOf(id);
+
+                if (i == NOT_FOUND)
+                    return false;
+
+                thunks[i](f);
+
+                return true;
+            }
+        }
+
+    private:
+
+        template <typename Fn, typename T>
+        static auto Dispatch(Fn& f) noexcept -> void
+        {
+            f.template operator() < T > ();
+        }
+    };
+
+    template <typename List>
+    struct TypeTupleSwitch;
+
+    template <>
+    struct TypeTupleSwitch<TypeList<>>
+    {
+        template <typename F>
+        static inline auto Apply(const std::type_info* const*, F&&) noexcept -> bool
+        {
+            return false;
+        }
+    };
+
+    template <typename... Tuples>
+    struct TypeTupleSwitch<TypeList<Tuples...>>
+    {
+        template <typename F>
+        static inline auto Apply(const std::type_info* const* ids, F&& f) noexcept -> bool
+        {
+            using Fn = std::remove_reference_t<F>;
+
+            static const Table table = BuildTable();
+            static constexpr void (*thunks[])(Fn&) noexcept = { &Entry<Tuples>::template Dispatch<Fn>... };
+
+            const size_t i = table.Find(ids);
+
+            if (i == Table::NOT_FOUND)
+                return false;
+
+            thunks[i](f);
+
+            return true;
+        }
+
+    private:
+
+        template <typename Tuple>
+        struct Entry;
+
+        template <typename... A>
+        struct Entry<TypeList<A...>> final
+        {
+            static constexpr size_t arity = sizeof...(A);
+            static constexpr const std::type_info* keys[] = { &typeid(A)... };
+
+            template <typename Fn>
+            static auto Dispatch(Fn& f) noexcept -> void
+            {
+                f.template operator() < A... > ();
+            }
+        };
+
+        template <typename First, typename... Rest>
+        static constexpr size_t ArityOf = Entry<First>::arity;
+
+        static constexpr size_t K = ArityOf<Tuples...>;
+
+        static_assert(((Entry<Tuples>::arity == K) && ...), "all type tuples must have the same arity");
+
+        using Table = Detail::TypeDispatchTable<sizeof...(Tuples), K>;
+
+        static auto BuildTable() noexcept -> Table
+        {
+            std::array<const std::type_info*, sizeof...(Tuples) * K> keys{};
+            size_t n = 0;
+
+            ([&]
+                {
+                    for (const std::type_info* t : Entry<Tuples>::keys)
+                        keys[n++] = t;
+                }(), ...);
+
+            return Table(keys);
         }
     };
 
@@ -93,6 +359,36 @@ namespace ReflectMeta
         };
     }
 
+    namespace Detail
+    {
+        template <typename... Ts>
+        struct TypeArgs final
+        {
+            static constexpr const std::type_info* value[] = { &typeid(Ts)... };
+        };
+
+        template <typename T, typename ClassT, template <typename> class RExpr, typename Binder, template <typename> class... AExprs>
+        static inline auto SpecializedCaller(void* self, void** args, void* retOut) noexcept -> void
+        {
+            CallBinderIndexed<T, ClassT, RExpr, Binder, AExprs...>(self, args, retOut, std::make_index_sequence<sizeof...(AExprs)>{});
+        }
+
+        template <typename List, typename ClassT, template <typename> class RExpr, typename Binder, template <typename> class... AExprs>
+        struct Specializations;
+
+        template <typename... Ts, typename ClassT, template <typename> class RExpr, typename Binder, template <typename> class... AExprs>
+        struct Specializations<TypeList<Ts...>, ClassT, RExpr, Binder, AExprs...> final
+        {
+            static constexpr TemplatedSpecialization value[] = { TemplatedSpecialization{ TypeArgs<Ts>::value, &SpecializedCaller<Ts, ClassT, RExpr, Binder, AExprs...> }... };
+        };
+    }
+
+    template <typename ConceptTag, typename ClassT, template <typename> class RExpr, typename Binder, template <typename> class... AExprs>
+    static constexpr auto GenericTemplatedSpecializations() noexcept -> std::span<const TemplatedSpecialization>
+    {
+        return Detail::Specializations<typename SupportedTypes<ConceptTag>::List, ClassT, RExpr, Binder, AExprs...>::value;
+    }
+
     template <typename ConceptTag, typename ClassT, template <typename> class RExpr, typename Binder, template <typename> class... AExprs>
     static inline auto GenericTemplatedErasedCaller(const std::type_info* const* typeArgs, void* self, void** args, void* retOut) noexcept -> void
     {
@@ -102,5 +398,105 @@ namespace ReflectMeta
         (void)TypeSwitch<List>::Apply(id, inv);
     }
 
+    namespace Detail
+    {
+        template <typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+        struct GenericMultiInvoker final
+        {
+            void* self;
+            void** args;
+            void* retOut;
+
+            template <typename... Ts>
+            inline auto operator()() const noexcept -> void
+            {
+                Call<Ts...>(self, args, retOut, std::make_index_sequence<sizeof...(AExprs)>{});
+            }
+
+            template <typename... Ts, std::size_t... I>
+            static inline auto Call(void* self, void** args, void* retOut, std::index_sequence<I...>) noexcept -> void
+            {
+                using R = typename RExpr<Ts...>::Type;
+                ClassT& object = *reinterpret_cast<ClassT*>(self);
+                if constexpr (!std::is_void_v<R>)
+                {
+                    using Store = std::remove_cvref_t<R>;
+                    Store result = Binder::template Call<Ts...>(object, Fetch<typename AExprs<Ts...>::Type>(args, I)...);
+                    *reinterpret_cast<Store*>(retOut) = result;
+                }
+                else
+                    Binder::template Call<Ts...>(object, Fetch<typename AExprs<Ts...>::Type>(args, I)...);
+            }
+        };
+
+        template <typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+        struct BinderAccepts final
+        {
+            template <typename Tuple>
+            struct For;
+
+            template <typename... Ts>
+            struct For<TypeList<Ts...>> final
+            {
+                static constexpr bool value = requires(ClassT& object, std::remove_reference_t<typename AExprs<Ts...>::Type>&... a) { Binder::template Call<Ts...>(object, a...); };
+            };
+        };
+
+        template <typename ConceptTags, typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+        struct MultiDispatch;
+
+        template <typename... Tags, typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+        struct MultiDispatch<TypeList<Tags...>, ClassT, RExpr, Binder, AExprs...> final
+        {
+            using Invoker = GenericMultiInvoker<ClassT, RExpr, Binder, AExprs...>;
+            using Tuples = typename Filter<BinderAccepts<ClassT, RExpr, Binder, AExprs...>::template For, typename Product<TypeList<>, typename SupportedTypes<Tags>::List...>::Type>::Type;
+
+            template <typename Tuple>
+            struct Entry;
+
+            template <typename... Ts>
+            struct Entry<TypeList<Ts...>> final
+            {
+                static auto Caller(void* self, void** args, void* retOut) noexcept -> void
+                {
+                    Invoker::template Call<Ts...>(self, args, retOut, std::make_index_sequence<sizeof...(AExprs)>{});
+                }
+
+                static constexpr TemplatedSpecialization value{ TypeArgs<Ts...>::value, &Caller };
+            };
+
+            template <typename List>
+            struct Table;
+
+            template <typename... Tuple>
+            struct Table<TypeList<Tuple...>> final
+            {
+                static constexpr TemplatedSpecialization value[] = { Entry<Tuple>::value... };
+            };
+
+            static constexpr auto Specializations() noexcept -> std::span<const TemplatedSpecialization>
+            {
+                if constexpr (std::is_same_v<Tuples, TypeList<>>)
+                    return {};
+                else
+                    return Table<Tuples>::value;
+            }
+        };
+    }
+
+    template <typename ConceptTags, typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+    static constexpr auto GenericMultiTemplatedSpecializations() noexcept -> std::span<const TemplatedSpecialization>
+    {
+        return Detail::MultiDispatch<ConceptTags, ClassT, RExpr, Binder, AExprs...>::Specializations();
+    }
+
+    template <typename ConceptTags, typename ClassT, template <typename...> class RExpr, typename Binder, template <typename...> class... AExprs>
+    static inline auto GenericMultiTemplatedErasedCaller(const std::type_info* const* typeArgs, void* self, void** args, void* retOut) noexcept -> void
+    {
+        using Dispatch = Detail::MultiDispatch<ConceptTags, ClassT, RExpr, Binder, AExprs...>;
+        typename Dispatch::Invoker inv{ self, args, retOut };
+        (void)TypeTupleSwitch<typename Dispatch::Tuples>::Apply(typeArgs, inv);
+    }
+
     struct DefaultTemplateTag final {};
 }